@@ -14,6 +14,7 @@
     [ PRE-DEFINES ]
         GTL_ECHO --- logs stuff.
         GTL_ONE_SURFACE --- enables quicker event routing.
+        GTL_NO_SIMD --- forces the scalar geometry kernels.
 
     [ GCC FLAGS ]
         -static-libgcc
@@ -41,16 +42,22 @@
     #include <queue>
     #include <vector>
     #include <array>
+    #include <iterator>
     #include <list>
     #include <forward_list>
     #include <map>
+    #include <unordered_map>
+    #include <set>
+    #include <unordered_set>
     #include <deque>
     #include <algorithm>
+    #include <numeric>
     #include <utility>
     #include <memory>
     #include <condition_variable>
     #include <cmath>
     #include <optional>
+    #include <span>
     #include <variant>
     #include <functional>
     #include <concepts>
@@ -62,6 +69,7 @@
     #include <tuple>
     #include <bitset>
     #include <atomic>
+    #include <cstring>
 
     #include <windows.h>
     #include <wincodec.h>
@@ -92,6 +100,10 @@
         #define _ENGINE_ONE_SURFACE
     #endif
 
+    #if !defined( GTL_NO_SIMD ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+        #define _ENGINE_SIMD_X86
+    #endif
+
 
 
 #pragma endregion Defines
@@ -114,9 +126,72 @@ namespace _ENGINE_NAMESPACE {
 
 
 
-    class Vec2;
-    class Ray2;
-    class Clust2;
+    template< int F > class Fixed;
+
+    template< typename T > class Vec2_t;
+    template< typename T > class Ray2_t;
+    template< typename T > class Box2_t;
+    template< typename T > class Clust2_t;
+    template< typename T > struct Hit2_t;
+    template< typename T > struct Crossing2_t;
+    template< typename T > struct Contact2_t;
+    template< typename T > struct Proximity2_t;
+    template< typename T > struct Motion2_t;
+    template< typename T > struct Impact2_t;
+    template< typename T > struct Mass2_t;
+    template< typename T > struct Nearest2_t;
+    template< typename T > struct Region2_t;
+
+    template< typename T > class Gjk_t;
+    template< typename T > class Collision_world_t;
+    template< typename T > class Sweep_t;
+    template< typename T > class Physics_world_t;
+    template< typename T > class Clip2_t;
+    template< typename T > class Plane_sweep_t;
+    template< typename T > class Sdf2_t;
+    template< typename T > class Visibility2_t;
+    template< typename T > class Navmesh2_t;
+    template< typename T > class Flow2_t;
+    template< typename T > class Path2_t;
+
+    typedef   Vec2_t< double >               Vec2;
+    typedef   Ray2_t< double >               Ray2;
+    typedef   Box2_t< double >               Box2;
+    typedef   Clust2_t< double >             Clust2;
+    typedef   Hit2_t< double >               Hit2;
+    typedef   Crossing2_t< double >          Crossing2;
+    typedef   Contact2_t< double >           Contact2;
+    typedef   Proximity2_t< double >         Proximity2;
+    typedef   Motion2_t< double >            Motion2;
+    typedef   Impact2_t< double >            Impact2;
+    typedef   Mass2_t< double >              Mass2;
+    typedef   Nearest2_t< double >           Nearest2;
+    typedef   Region2_t< double >            Region2;
+    typedef   Gjk_t< double >                Gjk;
+    typedef   Collision_world_t< double >    Collision_world;
+    typedef   Sweep_t< double >              Sweep;
+    typedef   Physics_world_t< double >      Physics_world;
+    typedef   Clip2_t< double >              Clip2;
+    typedef   Plane_sweep_t< double >        Plane_sweep;
+    typedef   Sdf2_t< double >               Sdf2;
+    typedef   Visibility2_t< double >        Visibility2;
+    typedef   Navmesh2_t< double >           Navmesh2;
+    typedef   Flow2_t< double >              Flow2;
+    typedef   Path2_t< double >              Path2;
+
+    typedef   Vec2_t< float >                Vec2f;
+    typedef   Ray2_t< float >                Ray2f;
+    typedef   Box2_t< float >                Box2f;
+    typedef   Clust2_t< float >              Clust2f;
+    typedef   Collision_world_t< float >     Collision_worldf;
+    typedef   Physics_world_t< float >       Physics_worldf;
+
+    typedef   Vec2_t< Fixed< 32 > >              Vec2x;
+    typedef   Ray2_t< Fixed< 32 > >              Ray2x;
+    typedef   Box2_t< Fixed< 32 > >              Box2x;
+    typedef   Clust2_t< Fixed< 32 > >            Clust2x;
+    typedef   Collision_world_t< Fixed< 32 > >   Collision_worldx;
+    typedef   Physics_world_t< Fixed< 32 > >     Physics_worldx;
 
     class Surface;
     class Renderer;
@@ -404,6 +479,83 @@ namespace _ENGINE_NAMESPACE {
 
     };
 
+    template< typename T, size_t N >
+    class Inline_vec {
+    public:
+        typedef   T   value_type;
+
+    public:
+        Inline_vec() = default;
+
+    private:
+        std :: array< T, N >   _inline   = {};
+        std :: vector< T >     _spill    = {};
+        size_t                 _size     = 0;
+
+    public:
+        size_t size() const {
+            return _size;
+        }
+
+        bool empty() const {
+            return _size == 0;
+        }
+
+        bool is_inline() const {
+            return _spill.empty();
+        }
+
+        T* data() {
+            return is_inline() ? _inline.data() : _spill.data();
+        }
+
+        const T* data() const {
+            return is_inline() ? _inline.data() : _spill.data();
+        }
+
+    public:
+        T* begin() { return data(); }
+        T* end() { return data() + _size; }
+
+        const T* begin() const { return data(); }
+        const T* end() const { return data() + _size; }
+
+        T& operator [] ( size_t idx ) {
+            return data()[ idx ];
+        }
+
+        const T& operator [] ( size_t idx ) const {
+            return data()[ idx ];
+        }
+
+    public:
+        Inline_vec& push_back( const T& value ) {
+            if( is_inline() && _size < N ) {
+                _inline[ _size++ ] = value;
+
+                return *this;
+            }
+
+            if( is_inline() ) {
+                _spill.reserve( 2 * N + 1 );
+                _spill.assign( _inline.begin(), _inline.begin() + _size );
+            }
+
+            _spill.push_back( value );
+            ++_size;
+
+            return *this;
+        }
+
+        Inline_vec& clear() {
+            _spill.clear();
+            _size = 0;
+
+            return *this;
+        }
+
+    };
+
 
 
     class File {
@@ -511,6 +663,97 @@ namespace _ENGINE_NAMESPACE {
 
 
 
+    class Mapped_file {
+    public:
+        Mapped_file() = default;
+
+        Mapped_file( std :: string_view path ) {
+            _file = CreateFileA( path.data(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+
+            if( _file == INVALID_HANDLE_VALUE ) return;
+
+            LARGE_INTEGER size = {};
+
+            if( !GetFileSizeEx( _file, &size ) || size.QuadPart == 0 ) { _release(); return; }
+
+            _map = CreateFileMappingA( _file, NULL, PAGE_READONLY, 0, 0, NULL );
+
+            if( !_map ) { _release(); return; }
+
+            _data = static_cast< const char* >( MapViewOfFile( _map, FILE_MAP_READ, 0, 0, 0 ) );
+
+            if( !_data ) { _release(); return; }
+
+            _size = static_cast< size_t >( size.QuadPart );
+        }
+
+        Mapped_file( const Mapped_file& ) = delete;
+
+        Mapped_file& operator = ( const Mapped_file& ) = delete;
+
+        Mapped_file( Mapped_file&& other ) noexcept
+            : _file( std :: exchange( other._file, INVALID_HANDLE_VALUE ) ),
+              _map ( std :: exchange( other._map, nullptr ) ),
+              _data( std :: exchange( other._data, nullptr ) ),
+              _size( std :: exchange( other._size, 0 ) )
+        {}
+
+        Mapped_file& operator = ( Mapped_file&& other ) noexcept {
+            if( this == &other ) return *this;
+
+            _release();
+
+            _file = std :: exchange( other._file, INVALID_HANDLE_VALUE );
+            _map  = std :: exchange( other._map, nullptr );
+            _data = std :: exchange( other._data, nullptr );
+            _size = std :: exchange( other._size, 0 );
+
+            return *this;
+        }
+
+        ~Mapped_file() {
+            _release();
+        }
+
+    private:
+        HANDLE        _file   = INVALID_HANDLE_VALUE;
+        HANDLE        _map    = nullptr;
+        const char*   _data   = nullptr;
+        size_t        _size   = 0;
+
+    public:
+        const char* data() const {
+            return _data;
+        }
+
+        size_t size() const {
+            return _size;
+        }
+
+        std :: span< const char > bytes() const {
+            return { _data, _size };
+        }
+
+        explicit operator bool () const {
+            return _data != nullptr;
+        }
+
+    private:
+        void _release() {
+            if( _data ) UnmapViewOfFile( _data );
+            if( _map ) CloseHandle( _map );
+            if( _file != INVALID_HANDLE_VALUE ) CloseHandle( _file );
+
+            _file = INVALID_HANDLE_VALUE;
+            _map  = nullptr;
+            _data = nullptr;
+            _size = 0;
+        }
+
+    };
+
+
+
     class Bytes {
     public:
         enum Endianess {
@@ -539,6 +782,105 @@ namespace _ENGINE_NAMESPACE {
 
 
 
+    /* xoshiro256**, seeded through splitmix64. Each jump() skips 2^128 draws, so jumped copies are independent streams. */
+    class Xoshiro256 {
+    public:
+        typedef   uint64_t   result_type;
+
+    public:
+        Xoshiro256( uint64_t seed = 0 ) {
+            for( uint64_t& word : _state ) {
+                seed += 0x9E3779B97F4A7C15ull;
+
+                uint64_t z = seed;
+                z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+                z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+
+                word = z ^ ( z >> 31 );
+            }
+        }
+
+    private:
+        uint64_t   _state[ 4 ]   = {};
+
+    public:
+        static constexpr result_type min() {
+            return 0;
+        }
+
+        static constexpr result_type max() {
+            return ~result_type( 0 );
+        }
+
+        result_type operator () () {
+            const uint64_t result = _rotl( _state[ 1 ] * 5, 7 ) * 9;
+            const uint64_t t      = _state[ 1 ] << 17;
+
+            _state[ 2 ] ^= _state[ 0 ];
+            _state[ 3 ] ^= _state[ 1 ];
+            _state[ 1 ] ^= _state[ 2 ];
+            _state[ 0 ] ^= _state[ 3 ];
+
+            _state[ 2 ] ^= t;
+            _state[ 3 ]  = _rotl( _state[ 3 ], 45 );
+
+            return result;
+        }
+
+        double unit() {
+            return static_cast< double >( ( *this )() >> 11 ) * 0x1.0p-53;
+        }
+
+    public:
+        Xoshiro256& jump() {
+            static constexpr uint64_t poly[ 4 ] = { 
+                0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull 
+            };
+
+            return _leap( poly );
+        }
+
+        Xoshiro256& long_jump() {
+            static constexpr uint64_t poly[ 4 ] = { 
+                0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull 
+            };
+
+            return _leap( poly );
+        }
+
+        Xoshiro256 jumped( size_t count = 1 ) const {
+            Xoshiro256 other = *this;
+
+            while( count-- > 0 ) other.jump();
+
+            return other;
+        }
+
+    private:
+        static uint64_t _rotl( uint64_t x, int k ) {
+            return ( x << k ) | ( x >> ( 64 - k ) );
+        }
+
+        Xoshiro256& _leap( const uint64_t ( &poly )[ 4 ] ) {
+            uint64_t acc[ 4 ] = {};
+
+            for( uint64_t word : poly )
+                for( int bit = 0; bit < 64; ++bit ) {
+                    if( word & ( uint64_t( 1 ) << bit ) )
+                        for( int idx = 0; idx < 4; ++idx ) acc[ idx ] ^= _state[ idx ];
+
+                    ( *this )();
+                }
+
+            std :: copy( acc, acc + 4, _state );
+
+            return *this;
+        }
+
+    };
+
+
+
     class Env {
     public:
         static int W() {
@@ -645,6 +987,180 @@ namespace _ENGINE_NAMESPACE {
 
 
 
+    template< typename F >
+    requires std :: is_invocable_v< F, size_t, size_t >
+    void parallel_for( size_t count, size_t thread_count, F&& func ) {
+        if( thread_count == 0 ) 
+            thread_count = std :: max< size_t >( std :: thread :: hardware_concurrency(), 1 );
+
+        thread_count = std :: min( thread_count, count );
+
+        if( thread_count <= 1 ) {
+            if( count > 0 ) func( 0, count );
+
+            return;
+        }
+
+
+        std :: vector< std :: thread > threads;
+        threads.reserve( thread_count - 1 );
+
+        const size_t chunk = count / thread_count;
+        const size_t rem   = count % thread_count;
+
+        size_t begin = 0;
+
+        for( size_t t = 0; t < thread_count; ++t ) {
+            size_t end = begin + chunk + ( t < rem ? 1 : 0 );
+
+            if( t == thread_count - 1 ) 
+                func( begin, end );
+            else
+                threads.emplace_back( [ &func, begin, end ] () -> void { func( begin, end ); } );
+
+            begin = end;
+        }
+
+        for( std :: thread& thread : threads )
+            thread.join();
+    }
+
+
+
+    /*
+        Threads kept alive across repeated fan-outs, such as every physics step or every wave of an
+        iterative solve, where spawning per call would cost more than the work. Chunks split exactly as
+        in parallel_for and the calling thread takes the last one. One fan-out at a time per pool, and
+        copies start out empty.
+    */
+    class Thread_pool {
+    public:
+        Thread_pool() = default;
+
+        Thread_pool( const Thread_pool& )
+            : Thread_pool{}
+        {}
+
+        Thread_pool& operator = ( const Thread_pool& ) {
+            return *this;
+        }
+
+        ~Thread_pool() {
+            _resize( 0 );
+        }
+
+    private:
+        std :: vector< std :: thread >        _threads   = {};
+        std :: mutex                          _mtx       = {};
+        std :: condition_variable             _wake      = {};
+        std :: condition_variable             _done      = {};
+        std :: function< void( size_t ) >     _job       = {};
+        uint64_t                              _epoch     = 0;
+        size_t                                _pending   = 0;
+        bool                                  _stop      = false;
+
+    public:
+        size_t size() const {
+            return _threads.size();
+        }
+
+    public:
+        template< typename F >
+        requires std :: is_invocable_v< F, size_t, size_t >
+        void parallel_for( size_t count, size_t thread_count, F&& func ) {
+            if( thread_count == 0 ) 
+                thread_count = std :: max< size_t >( std :: thread :: hardware_concurrency(), 1 );
+
+            thread_count = std :: min( thread_count, count );
+
+            if( thread_count <= 1 ) {
+                if( count > 0 ) func( 0, count );
+
+                return;
+            }
+
+            const size_t chunk = count / thread_count;
+            const size_t rem   = count % thread_count;
+
+            auto bounds = [ chunk, rem ] ( size_t t ) -> std :: pair< size_t, size_t > {
+                const size_t begin = t * chunk + std :: min( t, rem );
+
+                return { begin, begin + chunk + ( t < rem ? 1 : 0 ) };
+            };
+
+            /* The pool only grows, workers past thread_count - 1 sit this one out. */
+            if( _threads.size() < thread_count - 1 ) _resize( thread_count - 1 );
+
+            {
+                std :: unique_lock< std :: mutex > lock( _mtx );
+
+                _job = [ &func, &bounds, last = thread_count - 1 ] ( size_t t ) -> void {
+                    if( t >= last ) return;
+
+                    auto [ begin, end ] = bounds( t );
+
+                    func( begin, end );
+                };
+
+                _pending = _threads.size();
+                ++_epoch;
+            }
+
+            _wake.notify_all();
+
+            auto [ begin, end ] = bounds( thread_count - 1 );
+
+            func( begin, end );
+
+            std :: unique_lock< std :: mutex > lock( _mtx );
+
+            _done.wait( lock, [ this ] () -> bool { return _pending == 0; } );
+
+            _job = {};
+        }
+
+    private:
+        void _resize( size_t count ) {
+            {
+                std :: unique_lock< std :: mutex > lock( _mtx );
+
+                _stop = true;
+            }
+
+            _wake.notify_all();
+
+            for( std :: thread& thread : _threads )
+                thread.join();
+
+            _threads.clear();
+            _stop = false;
+
+            for( size_t t = 0; t < count; ++t )
+                _threads.emplace_back( [ this, t, epoch = _epoch ] () -> void { _main( t, epoch ); } );
+        }
+
+        void _main( size_t t, uint64_t seen ) {
+            for(;;) {
+                std :: unique_lock< std :: mutex > lock( _mtx );
+
+                _wake.wait( lock, [ this, seen ] () -> bool { return _stop || _epoch != seen; } );
+
+                if( _stop ) return;
+
+                seen = _epoch;
+
+                lock.unlock();
+                _job( t );
+                lock.lock();
+
+                if( --_pending == 0 ) _done.notify_one();
+            }
+        }
+
+    };
+
+
+
     class Clock {
         public:
             Clock()
@@ -810,921 +1326,7836 @@ namespace _ENGINE_NAMESPACE {
         LOCAL = 0, GLOBAL
     };
 
+    enum Paint {
+        STROKE = 0, FILL
+    };
+
+    enum Boolean {
+        UNITE = 0, INTERSECT, SUBTRACT
+    };
 
 
-    class Deg {
+
+    template< int F >
+    class Fixed {
     public:
-        static double pull( double theta ) {
-            return theta * ( 180.0 / PI );
-        }
+        static_assert( F > 0 && F < 62 );
 
-        static void push( double& theta ) {
-            theta *= ( 180.0 / PI );
+        inline static constexpr int       FRACTION   = F;
+        inline static constexpr int64_t   ONE        = int64_t{ 1 } << F;
+
+    public:
+        constexpr Fixed() = default;
+
+        template< typename A >
+        requires std :: is_arithmetic_v< A >
+        constexpr Fixed( A value ) {
+            if constexpr( std :: is_floating_point_v< A > )
+                _raw = static_cast< int64_t >( static_cast< double >( value ) * ONE + ( value < 0 ? -0.5 : 0.5 ) );
+            else
+                _raw = static_cast< int64_t >( value ) * ONE;
         }
-    };
 
-    class Rad {
+    private:
+        int64_t   _raw   = 0;
+
     public:
-        static double pull( double theta ) {
-            return theta * ( PI / 180.0 );
+        static constexpr Fixed from_raw( int64_t raw ) {
+            Fixed fixed{};
+            fixed._raw = raw;
+
+            return fixed;
         }
 
-        static void push( double& theta ) {
-            theta *= ( PI / 180.0 );
+        constexpr int64_t raw() const {
+            return _raw;
         }
-    };
 
+        template< typename A >
+        requires std :: is_arithmetic_v< A >
+        explicit constexpr operator A () const {
+            if constexpr( std :: is_same_v< A, bool > )
+                return _raw != 0;
+            else if constexpr( std :: is_floating_point_v< A > )
+                return static_cast< A >( static_cast< double >( _raw ) / ONE );
+            else
+                return static_cast< A >( _raw >> F );
+        }
 
+    public:
+        static constexpr Fixed max() {
+            return from_raw( std :: numeric_limits< int64_t > :: max() );
+        }
 
-    #pragma region D2
+        static constexpr Fixed lowest() {
+            return from_raw( std :: numeric_limits< int64_t > :: min() );
+        }
 
+        static constexpr Fixed epsilon() {
+            return from_raw( 1 );
+        }
 
+    public:
+        friend constexpr bool operator == ( const Fixed&, const Fixed& ) = default;
+        friend constexpr auto operator <=> ( const Fixed&, const Fixed& ) = default;
 
-        class Ray2;
-        class Clust2;
+        friend constexpr Fixed operator + ( Fixed lhs, Fixed rhs ) {
+            return from_raw( lhs._raw + rhs._raw );
+        }
 
+        friend constexpr Fixed operator - ( Fixed lhs, Fixed rhs ) {
+            return from_raw( lhs._raw - rhs._raw );
+        }
 
+        friend constexpr Fixed operator * ( Fixed lhs, Fixed rhs ) {
+            return from_raw( static_cast< int64_t >( ( static_cast< __int128 >( lhs._raw ) * rhs._raw ) >> F ) );
+        }
 
-        class Vec2 {
-        public:
-            Vec2() = default;
+        friend constexpr Fixed operator / ( Fixed lhs, Fixed rhs ) {
+            if( rhs._raw == 0 ) return lhs._raw < 0 ? lowest() : max();
 
-            Vec2( double x, double y ) 
-                : x( x ), y( y ) 
-            {}
+            return from_raw( static_cast< int64_t >( ( static_cast< __int128 >( lhs._raw ) * ONE ) / rhs._raw ) );
+        }
 
-            Vec2( double x )
-                : Vec2{ x, x }
-            {}
+        constexpr Fixed operator - () const {
+            return from_raw( -_raw );
+        }
 
-            Vec2( const Vec2& other )
-                : x( other.x ), y( other.y ) 
-            {}
+        constexpr Fixed& operator += ( Fixed other ) {
+            return *this = *this + other;
+        }
 
-        public:
-            double   x   = 0.0;
-            double   y   = 0.0;
+        constexpr Fixed& operator -= ( Fixed other ) {
+            return *this = *this - other;
+        }
+
+        constexpr Fixed& operator *= ( Fixed other ) {
+            return *this = *this * other;
+        }
+
+        constexpr Fixed& operator /= ( Fixed other ) {
+            return *this = *this / other;
+        }
+
+    public:
+        static Fixed abs( Fixed value ) {
+            return value._raw < 0 ? -value : value;
+        }
+
+        static Fixed sqrt( Fixed value ) {
+            if( value._raw <= 0 ) return {};
+
+            unsigned __int128 rem  = static_cast< unsigned __int128 >( value._raw ) << F;
+            unsigned __int128 root = 0;
+            unsigned __int128 bit  = static_cast< unsigned __int128 >( 1 ) << 126;
+
+            while( bit > rem ) bit >>= 2;
+
+            for( ; bit != 0; bit >>= 2 ) {
+                if( rem >= root + bit ) {
+                    rem  -= root + bit;
+                    root  = ( root >> 1 ) + bit;
+                } else
+                    root >>= 1;
+            }
+
+            return from_raw( static_cast< int64_t >( root ) );
+        }
+
+        static Fixed sin( Fixed theta ) {
+            const Fixed pi      = 3.14159265358979323846;
+            const Fixed half_pi = 1.57079632679489661923;
+            const Fixed two_pi  = 6.28318530717958647692;
+
+            theta -= two_pi * Fixed( ( ( theta / two_pi )._raw + ONE / 2 ) >> F );
+
+            if( theta > half_pi ) 
+                theta = pi - theta;
+            else if( theta < -half_pi ) 
+                theta = -pi - theta;
+
+            const Fixed sq = theta * theta;
+
+            Fixed series = 1;
+
+            for( int k = 7; k >= 1; --k )
+                series = Fixed( 1 ) - sq * series / Fixed( ( 2 * k ) * ( 2 * k + 1 ) );
+
+            return theta * series;
+        }
+
+        static Fixed cos( Fixed theta ) {
+            return sin( theta + Fixed( 1.57079632679489661923 ) );
+        }
+
+        static Fixed atan2( Fixed y, Fixed x ) {
+            if( x._raw == 0 && y._raw == 0 ) return {};
+
+            const Fixed pi      = 3.14159265358979323846;
+            const Fixed half_pi = 1.57079632679489661923;
+
+            const Fixed ax = abs( x );
+            const Fixed ay = abs( y );
+
+            Fixed angel = ay > ax ? half_pi - _atan_unit( ax / ay ) : _atan_unit( ay / ax );
+
+            if( x._raw < 0 ) angel = pi - angel;
+
+            return y._raw < 0 ? -angel : angel;
+        }
+
+    private:
+        static Fixed _atan_unit( Fixed t ) {
+            const Fixed sqrt3 = 1.73205080756887729353;
+
+            Fixed base = 0;
+
+            if( t > Fixed( 0.26794919243112270647 ) ) {
+                t    = ( t * sqrt3 - Fixed( 1 ) ) / ( sqrt3 + t );
+                base = 0.52359877559829887308;
+            }
+
+            const Fixed sq = t * t;
+
+            Fixed series = 0;
+
+            for( int k = 8; k >= 0; --k )
+                series = Fixed( k % 2 ? -1 : 1 ) / Fixed( 2 * k + 1 ) + sq * series;
+
+            return base + t * series;
+        }
+
+    };
+
+    typedef   Fixed< 32 >   Fixed32;
+    typedef   Fixed< 16 >   Fixed16;
+
+
+
+    template< typename T >
+    class Scalar {
+    public:
+        static T abs( T value ) {
+            return std :: abs( value );
+        }
+
+        static T sqrt( T value ) {
+            return std :: sqrt( value );
+        }
+
+        static T sin( T theta ) {
+            return std :: sin( theta );
+        }
+
+        static T cos( T theta ) {
+            return std :: cos( theta );
+        }
+
+        static T atan2( T y, T x ) {
+            return std :: atan2( y, x );
+        }
+
+        static constexpr T inf() {
+            return std :: numeric_limits< T > :: infinity();
+        }
+
+        static constexpr T eps() {
+            return std :: numeric_limits< T > :: epsilon();
+        }
+    };
+
+    template< int F >
+    class Scalar< Fixed< F > > {
+    public:
+        static Fixed< F > abs( Fixed< F > value ) {
+            return Fixed< F > :: abs( value );
+        }
+
+        static Fixed< F > sqrt( Fixed< F > value ) {
+            return Fixed< F > :: sqrt( value );
+        }
+
+        static Fixed< F > sin( Fixed< F > theta ) {
+            return Fixed< F > :: sin( theta );
+        }
+
+        static Fixed< F > cos( Fixed< F > theta ) {
+            return Fixed< F > :: cos( theta );
+        }
+
+        static Fixed< F > atan2( Fixed< F > y, Fixed< F > x ) {
+            return Fixed< F > :: atan2( y, x );
+        }
+
+        static constexpr Fixed< F > inf() {
+            return Fixed< F > :: max();
+        }
+
+        static constexpr Fixed< F > eps() {
+            return Fixed< F > :: epsilon();
+        }
+    };
+
+
+
+    class Deg {
+    public:
+        static double pull( double theta ) {
+            return theta * ( 180.0 / PI );
+        }
+
+        static void push( double& theta ) {
+            theta *= ( 180.0 / PI );
+        }
+
+        template< typename T >
+        requires ( !std :: is_arithmetic_v< T > || std :: is_floating_point_v< T > )
+        static T pull( T theta ) {
+            return theta * T( 180.0 / PI );
+        }
+
+        template< typename T >
+        requires ( !std :: is_arithmetic_v< T > || std :: is_floating_point_v< T > )
+        static void push( T& theta ) {
+            theta *= T( 180.0 / PI );
+        }
+    };
+
+    class Rad {
+    public:
+        static double pull( double theta ) {
+            return theta * ( PI / 180.0 );
+        }
+
+        static void push( double& theta ) {
+            theta *= ( PI / 180.0 );
+        }
+
+        template< typename T >
+        requires ( !std :: is_arithmetic_v< T > || std :: is_floating_point_v< T > )
+        static T pull( T theta ) {
+            return theta * T( PI / 180.0 );
+        }
+
+        template< typename T >
+        requires ( !std :: is_arithmetic_v< T > || std :: is_floating_point_v< T > )
+        static void push( T& theta ) {
+            theta *= T( PI / 180.0 );
+        }
+    };
+
+
+
+    class Simd {
+    public:
+        enum Level {
+            SCALAR = 0, SSE, AVX2
+        };
+
+    private:
+        static Level _detect() {
+            #if defined( _ENGINE_SIMD_X86 )
+                __builtin_cpu_init();
+
+                if( __builtin_cpu_supports( "avx2" ) ) return AVX2;
+                if( __builtin_cpu_supports( "sse2" ) ) return SSE;
+            #endif
+
+            return SCALAR;
+        }
+
+    private:
+        inline static Level   _level   = _detect();
+
+    public:
+        static Level level() {
+            return _level;
+        }
+
+        static void cap_to( Level lvl ) {
+            _level = std :: min( lvl, _detect() );
+        }
+
+        template< typename T >
+        static size_t width() {
+            if constexpr( std :: is_floating_point_v< T > )
+                switch( _level ) {
+                    case AVX2: return 32 / sizeof( T );
+                    case SSE:  return 16 / sizeof( T );
+
+                    default: break;
+                }
+
+            return 1;
+        }
+
+    public:
+        template< typename T >
+        static void spin_scale( 
+            const T* bx, const T* by, 
+            T* x, T* y, 
+            size_t count, 
+            T theta, T scaleX, T scaleY 
+        ) {
+            Rad :: push( theta );
+
+            const T c = Scalar< T > :: cos( theta );
+            const T s = Scalar< T > :: sin( theta );
+
+            size_t idx = 0;
+
+            #if defined( _ENGINE_SIMD_X86 )
+                if constexpr( std :: is_floating_point_v< T > )
+                    switch( _level ) {
+                        case AVX2: idx = _spin_scale_avx2( bx, by, x, y, count, c, s, scaleX, scaleY ); break;
+                        case SSE:  idx = _spin_scale_sse( bx, by, x, y, count, c, s, scaleX, scaleY ); break;
+
+                        default: break;
+                    }
+            #endif
+
+            for( ; idx < count; ++idx ) {
+                T nx = bx[ idx ] * c - by[ idx ] * s;
+                T ny = bx[ idx ] * s + by[ idx ] * c;
+
+                x[ idx ] = nx * scaleX;
+                y[ idx ] = ny * scaleY;
+            }
+        }
+
+
+    public:
+        template< typename T >
+        static void crossings( 
+            const T* ax, const T* ay, const T* by, const T* slope, 
+            size_t edge_count,
+            const T* box,
+            const T* xy, uint8_t* out, 
+            size_t count 
+        ) {
+            size_t idx = 0;
+
+            #if defined( _ENGINE_SIMD_X86 )
+                if constexpr( std :: is_floating_point_v< T > )
+                    switch( _level ) {
+                        case AVX2: idx = _crossings_avx2( ax, ay, by, slope, edge_count, box, xy, out, count ); break;
+                        case SSE:  idx = _crossings_sse( ax, ay, by, slope, edge_count, box, xy, out, count ); break;
+
+                        default: break;
+                    }
+            #endif
+
+            for( ; idx < count; ++idx ) {
+                const T px = xy[ 2 * idx ];
+                const T py = xy[ 2 * idx + 1 ];
+
+                bool inside = false;
+
+                if( px >= box[ 0 ] && py >= box[ 1 ] && px <= box[ 2 ] && py <= box[ 3 ] )
+                    for( size_t e = 0; e < edge_count; ++e )
+                        if( ( ay[ e ] > py ) != ( by[ e ] > py ) && px < ax[ e ] + ( py - ay[ e ] ) * slope[ e ] )
+                            inside = !inside;
+
+                out[ idx ] = inside;
+            }
+        }
+
+    public:
+        template< typename T >
+        static void strike( 
+            const T* edges, size_t edge_count,
+            const T* rays, size_t ray_count,
+            T* best_t, size_t* best_edge, size_t* best_tag, 
+            size_t tag
+        ) {
+            size_t idx = 0;
+
+            #if defined( _ENGINE_SIMD_X86 )
+                if constexpr( std :: is_floating_point_v< T > )
+                    switch( _level ) {
+                        case AVX2: idx = _strike_avx2( edges, edge_count, rays, ray_count, best_t, best_edge, best_tag, tag ); break;
+                        case SSE:  idx = _strike_sse( edges, edge_count, rays, ray_count, best_t, best_edge, best_tag, tag ); break;
+
+                        default: break;
+                    }
+            #endif
+
+            for( ; idx < ray_count; ++idx ) {
+                const T ox = rays[ 4 * idx ];
+                const T oy = rays[ 4 * idx + 1 ];
+                const T vx = rays[ 4 * idx + 2 ];
+                const T vy = rays[ 4 * idx + 3 ];
+
+                for( size_t e = 0; e < edge_count; ++e ) {
+                    const T qx = edges[ 4 * e ] - ox;
+                    const T qy = edges[ 4 * e + 1 ] - oy;
+                    const T sx = edges[ 4 * e + 2 ];
+                    const T sy = edges[ 4 * e + 3 ];
+
+                    const T denom = vx * sy - vy * sx;
+
+                    if( denom == T( 0 ) ) continue;
+
+                    const T t = ( qx * sy - qy * sx ) / denom;
+                    const T u = ( qx * vy - qy * vx ) / denom;
+
+                    if( t >= T( 0 ) && t < best_t[ idx ] && u >= T( 0 ) && u <= T( 1 ) ) {
+                        best_t[ idx ]    = t;
+                        best_edge[ idx ] = e;
+                        best_tag[ idx ]  = tag;
+                    }
+                }
+            }
+        }
+
+    public:
+        /* Edges as origin and direction quads, per point the squared distance, edge and clamped parameter of the nearest one. */
+        template< typename T >
+        static void nearest( 
+            const T* edges, size_t edge_count,
+            const T* xy, size_t count,
+            T* best_d2, size_t* best_edge, T* best_u
+        ) {
+            size_t idx = 0;
+
+            #if defined( _ENGINE_SIMD_X86 )
+                if constexpr( std :: is_floating_point_v< T > )
+                    switch( _level ) {
+                        case AVX2: idx = _nearest_avx2( edges, edge_count, xy, count, best_d2, best_edge, best_u ); break;
+                        case SSE:  idx = _nearest_sse( edges, edge_count, xy, count, best_d2, best_edge, best_u ); break;
+
+                        default: break;
+                    }
+            #endif
+
+            for( ; idx < count; ++idx ) {
+                const T px = xy[ 2 * idx ];
+                const T py = xy[ 2 * idx + 1 ];
+
+                best_d2[ idx ]   = Scalar< T > :: inf();
+                best_edge[ idx ] = 0;
+                best_u[ idx ]    = 0.0;
+
+                for( size_t e = 0; e < edge_count; ++e ) {
+                    const T dx     = edges[ 4 * e + 2 ];
+                    const T dy     = edges[ 4 * e + 3 ];
+                    const T len_sq = dx * dx + dy * dy;
+
+                    const T qx = px - edges[ 4 * e ];
+                    const T qy = py - edges[ 4 * e + 1 ];
+
+                    const T u  = std :: clamp( ( qx * dx + qy * dy ) / ( len_sq > T( 0 ) ? len_sq : T( 1 ) ), T( 0 ), T( 1 ) );
+                    const T ex = qx - dx * u;
+                    const T ey = qy - dy * u;
+                    const T d2 = ex * ex + ey * ey;
+
+                    if( d2 < best_d2[ idx ] ) {
+                        best_d2[ idx ]   = d2;
+                        best_edge[ idx ] = e;
+                        best_u[ idx ]    = u;
+                    }
+                }
+            }
+        }
+
+    private:
+    #if defined( _ENGINE_SIMD_X86 )
+        /* 
+            The kernels are written once over GCC vector extensions and stamped out per instruction set,
+            so a float instantiation runs twice as many lanes as a double one on the same registers.
+        */
+        template< typename T, size_t W >
+        struct _Pack {
+            typedef   T                               Lane __attribute__(( vector_size( sizeof( T ) * W ) ));
+            typedef   decltype( Lane{} < Lane{} )     Mask;
+
+            typedef   std :: conditional_t< sizeof( T ) == 8, int64_t, int32_t >   Index;
+        };
+
+        template< typename T >
+        __attribute__(( target( "avx2" ) ))
+        static size_t _spin_scale_avx2( const T* bx, const T* by, T* x, T* y, size_t count, T c, T s, T scaleX, T scaleY ) {
+            return _spin_scale_lanes< T, 32 / sizeof( T ) >( bx, by, x, y, count, c, s, scaleX, scaleY );
+        }
+
+        template< typename T >
+        __attribute__(( target( "sse2" ) ))
+        static size_t _spin_scale_sse( const T* bx, const T* by, T* x, T* y, size_t count, T c, T s, T scaleX, T scaleY ) {
+            return _spin_scale_lanes< T, 16 / sizeof( T ) >( bx, by, x, y, count, c, s, scaleX, scaleY );
+        }
+
+        template< typename T >
+        __attribute__(( target( "avx2" ) ))
+        static size_t _crossings_avx2( 
+            const T* ax, const T* ay, const T* by, const T* slope, size_t edge_count, 
+            const T* box, const T* xy, uint8_t* out, size_t count 
+        ) {
+            return _crossings_lanes< T, 32 / sizeof( T ) >( ax, ay, by, slope, edge_count, box, xy, out, count );
+        }
+
+        template< typename T >
+        __attribute__(( target( "sse2" ) ))
+        static size_t _crossings_sse( 
+            const T* ax, const T* ay, const T* by, const T* slope, size_t edge_count, 
+            const T* box, const T* xy, uint8_t* out, size_t count 
+        ) {
+            return _crossings_lanes< T, 16 / sizeof( T ) >( ax, ay, by, slope, edge_count, box, xy, out, count );
+        }
+
+        template< typename T >
+        __attribute__(( target( "avx2" ) ))
+        static size_t _strike_avx2( 
+            const T* edges, size_t edge_count, const T* rays, size_t ray_count,
+            T* best_t, size_t* best_edge, size_t* best_tag, size_t tag
+        ) {
+            return _strike_lanes< T, 32 / sizeof( T ) >( edges, edge_count, rays, ray_count, best_t, best_edge, best_tag, tag );
+        }
+
+        template< typename T >
+        __attribute__(( target( "sse2" ) ))
+        static size_t _strike_sse( 
+            const T* edges, size_t edge_count, const T* rays, size_t ray_count,
+            T* best_t, size_t* best_edge, size_t* best_tag, size_t tag
+        ) {
+            return _strike_lanes< T, 16 / sizeof( T ) >( edges, edge_count, rays, ray_count, best_t, best_edge, best_tag, tag );
+        }
+
+        template< typename T >
+        __attribute__(( target( "avx2" ) ))
+        static size_t _nearest_avx2( 
+            const T* edges, size_t edge_count, const T* xy, size_t count,
+            T* best_d2, size_t* best_edge, T* best_u
+        ) {
+            return _nearest_lanes< T, 32 / sizeof( T ) >( edges, edge_count, xy, count, best_d2, best_edge, best_u );
+        }
+
+        template< typename T >
+        __attribute__(( target( "sse2" ) ))
+        static size_t _nearest_sse( 
+            const T* edges, size_t edge_count, const T* xy, size_t count,
+            T* best_d2, size_t* best_edge, T* best_u
+        ) {
+            return _nearest_lanes< T, 16 / sizeof( T ) >( edges, edge_count, xy, count, best_d2, best_edge, best_u );
+        }
+
+    private:
+        template< typename T, size_t W >
+        __attribute__(( always_inline ))
+        static size_t _spin_scale_lanes( 
+            const T* bx, const T* by, 
+            T* x, T* y, 
+            size_t count, 
+            T c, T s, T scaleX, T scaleY 
+        ) {
+            typedef   typename _Pack< T, W > :: Lane   Lane;
+
+            size_t idx = 0;
+
+            for( ; idx + W <= count; idx += W ) {
+                Lane vx, vy;
+
+                std :: memcpy( &vx, bx + idx, sizeof( Lane ) );
+                std :: memcpy( &vy, by + idx, sizeof( Lane ) );
+
+                Lane nx = ( vx * c - vy * s ) * scaleX;
+                Lane ny = ( vx * s + vy * c ) * scaleY;
+
+                std :: memcpy( x + idx, &nx, sizeof( Lane ) );
+                std :: memcpy( y + idx, &ny, sizeof( Lane ) );
+            }
+
+            return idx;
+        }
+
+        template< typename T, size_t W >
+        __attribute__(( always_inline ))
+        static size_t _crossings_lanes( 
+            const T* ax, const T* ay, const T* by, const T* slope, 
+            size_t edge_count,
+            const T* box,
+            const T* xy, uint8_t* out, 
+            size_t count 
+        ) {
+            typedef   typename _Pack< T, W > :: Lane   Lane;
+            typedef   typename _Pack< T, W > :: Mask   Mask;
+
+            size_t idx = 0;
+
+            for( ; idx + W <= count; idx += W ) {
+                Lane px, py;
+
+                for( size_t lane = 0; lane < W; ++lane ) {
+                    px[ lane ] = xy[ 2 * ( idx + lane ) ];
+                    py[ lane ] = xy[ 2 * ( idx + lane ) + 1 ];
+                }
+
+                Mask in_box = ( px >= box[ 0 ] ) & ( py >= box[ 1 ] ) & ( px <= box[ 2 ] ) & ( py <= box[ 3 ] );
+                Mask inside = {};
+
+                bool any = false;
+
+                for( size_t lane = 0; lane < W; ++lane )
+                    any |= in_box[ lane ] != 0;
+
+                if( any )
+                    for( size_t e = 0; e < edge_count; ++e ) {
+                        Mask straddle = ( ay[ e ] > py ) ^ ( by[ e ] > py );
+
+                        inside ^= straddle & ( px < ax[ e ] + ( py - ay[ e ] ) * slope[ e ] );
+                    }
+
+                inside &= in_box;
+
+                for( size_t lane = 0; lane < W; ++lane )
+                    out[ idx + lane ] = inside[ lane ] != 0;
+            }
+
+            return idx;
+        }
+
+        template< typename T, size_t W >
+        __attribute__(( always_inline ))
+        static size_t _strike_lanes( 
+            const T* edges, size_t edge_count,
+            const T* rays, size_t ray_count,
+            T* best_t, size_t* best_edge, size_t* best_tag, 
+            size_t tag
+        ) {
+            typedef   typename _Pack< T, W > :: Lane   Lane;
+            typedef   typename _Pack< T, W > :: Mask    Mask;
+            typedef   typename _Pack< T, W > :: Index   Index;
+
+            size_t idx = 0;
+
+            for( ; idx + W <= ray_count; idx += W ) {
+                Lane ox, oy, vx, vy, best;
+
+                for( size_t lane = 0; lane < W; ++lane ) {
+                    ox[ lane ] = rays[ 4 * ( idx + lane ) ];
+                    oy[ lane ] = rays[ 4 * ( idx + lane ) + 1 ];
+                    vx[ lane ] = rays[ 4 * ( idx + lane ) + 2 ];
+                    vy[ lane ] = rays[ 4 * ( idx + lane ) + 3 ];
+                }
+
+                std :: memcpy( &best, best_t + idx, sizeof( Lane ) );
+
+                Mask hit = Mask{} - 1;
+
+                for( size_t e = 0; e < edge_count; ++e ) {
+                    const T sx = edges[ 4 * e + 2 ];
+                    const T sy = edges[ 4 * e + 3 ];
+
+                    Lane qx = edges[ 4 * e ] - ox;
+                    Lane qy = edges[ 4 * e + 1 ] - oy;
+
+                    Lane denom = vx * sy - vy * sx;
+
+                    Lane t = ( qx * sy - qy * sx ) / denom;
+                    Lane u = ( qx * vy - qy * vx ) / denom;
+
+                    Mask mask = ( denom != T( 0 ) ) & ( t >= T( 0 ) ) & ( t < best ) & ( u >= T( 0 ) ) & ( u <= T( 1 ) );
+
+                    best = mask ? t : best;
+                    hit  = mask ? Mask{} + static_cast< Index >( e ) : hit;
+                }
+
+                std :: memcpy( best_t + idx, &best, sizeof( Lane ) );
+
+                for( size_t lane = 0; lane < W; ++lane ) {
+                    if( hit[ lane ] < 0 ) continue;
+
+                    best_edge[ idx + lane ] = static_cast< size_t >( hit[ lane ] );
+                    best_tag[ idx + lane ]  = tag;
+                }
+            }
+
+            return idx;
+        }
+
+        template< typename T, size_t W >
+        __attribute__(( always_inline ))
+        static size_t _nearest_lanes( 
+            const T* edges, size_t edge_count,
+            const T* xy, size_t count,
+            T* best_d2, size_t* best_edge, T* best_u
+        ) {
+            typedef   typename _Pack< T, W > :: Lane    Lane;
+            typedef   typename _Pack< T, W > :: Mask    Mask;
+            typedef   typename _Pack< T, W > :: Index   Index;
+
+            size_t idx = 0;
+
+            for( ; idx + W <= count; idx += W ) {
+                Lane px, py;
+
+                for( size_t lane = 0; lane < W; ++lane ) {
+                    px[ lane ] = xy[ 2 * ( idx + lane ) ];
+                    py[ lane ] = xy[ 2 * ( idx + lane ) + 1 ];
+                }
+
+                Lane best   = Lane{} + Scalar< T > :: inf();
+                Lane best_t = {};
+                Mask edge   = {};
+
+                for( size_t e = 0; e < edge_count; ++e ) {
+                    const T dx     = edges[ 4 * e + 2 ];
+                    const T dy     = edges[ 4 * e + 3 ];
+                    const T len_sq = dx * dx + dy * dy;
+
+                    Lane qx = px - edges[ 4 * e ];
+                    Lane qy = py - edges[ 4 * e + 1 ];
+
+                    Lane u = ( qx * dx + qy * dy ) / ( len_sq > T( 0 ) ? len_sq : T( 1 ) );
+
+                    u = u < T( 0 ) ? Lane{} : u;
+                    u = u > T( 1 ) ? Lane{} + T( 1 ) : u;
+
+                    Lane ex = qx - u * dx;
+                    Lane ey = qy - u * dy;
+                    Lane d2 = ex * ex + ey * ey;
+
+                    Mask mask = d2 < best;
+
+                    best   = mask ? d2 : best;
+                    best_t = mask ? u : best_t;
+                    edge   = mask ? Mask{} + static_cast< Index >( e ) : edge;
+                }
+
+                std :: memcpy( best_d2 + idx, &best, sizeof( Lane ) );
+                std :: memcpy( best_u + idx, &best_t, sizeof( Lane ) );
+
+                for( size_t lane = 0; lane < W; ++lane )
+                    best_edge[ idx + lane ] = static_cast< size_t >( edge[ lane ] );
+            }
+
+            return idx;
+        }
+    #endif
+
+    };
+
+    #pragma region D2
+
+
+
+        template< typename T >
+        class Vec2_t {
+        public:
+            typedef   Vec2_t          Vec2;
+            typedef   Ray2_t< T >     Ray2;
+            typedef   Clust2_t< T >   Clust2;
+
+        public:
+            Vec2_t() = default;
+
+            Vec2_t( T x, T y ) 
+                : x( x ), y( y ) 
+            {}
+
+            Vec2_t( T x )
+                : Vec2_t{ x, x }
+            {}
+
+            Vec2_t( const Vec2_t& other )
+                : x( other.x ), y( other.y ) 
+            {}
+
+            template< typename U >
+            requires ( !std :: is_same_v< T, U > )
+            explicit Vec2_t( const Vec2_t< U >& other )
+                : x( static_cast< T >( other.x ) ), y( static_cast< T >( other.y ) )
+            {}
+
+        public:
+            T   x   = 0.0;
+            T   y   = 0.0;
+
+        public:
+            T dot( const Vec2& other ) const {
+                return x * other.x + y * other.y;
+            }
+            
+        public:
+            T mag_sq() const {
+                return x * x + y * y;
+            }
+
+            T mag() const {
+                return Scalar< T > :: sqrt( mag_sq() );
+            }
+
+            T angel() const {
+                return Deg :: pull( Scalar< T > :: atan2( y, x ) );
+            }
+
+        public:
+            T dist_sq_to( const Vec2& other ) const {
+                return ( other.x - x ) * ( other.x - x ) + ( other.y - y ) * ( other.y - y );
+            }
+
+            T dist_to( const Vec2& other ) const {
+                return Scalar< T > :: sqrt( dist_sq_to( other ) );
+            }
+
+        public:
+            Vec2 respect_to( const Vec2& other ) const {
+                return { x - other.x, y - other.y };
+            }
+
+            Vec2 operator () ( const Vec2& other ) const {
+                return this -> respect_to( other );
+            }
+
+        public:
+            Vec2& polar( T angel, T dist ) {
+                Rad :: push( angel );
+
+                x += Scalar< T > :: cos( angel ) * dist;
+                y += Scalar< T > :: sin( angel ) * dist;
+
+                return *this;
+            }
+
+            Vec2 polared( T angel, T dist ) const {
+                return Vec2( *this ).polar( angel, dist );
+            }
+
+
+            Vec2& approach( const Vec2 other, T dist ) {
+                return polar( other( *this ).angel(), dist );
+            }
+            
+            Vec2 approached( const Vec2 other, T dist ) const {
+                return Vec2{ *this }.approach( other, dist );
+            }
+
+
+            Vec2& spin( T theta ) {
+                Rad :: push( theta );
+
+                T nx = x * Scalar< T > :: cos( theta ) - y * Scalar< T > :: sin( theta );
+                y = x * Scalar< T > :: sin( theta ) + y * Scalar< T > :: cos( theta );
+                x = nx;
+
+                return *this;
+            }
+
+            Vec2& spin( T theta, const Vec2& other ) {
+                *this = this -> respect_to( other ).spin( theta ) + other;
+
+                return *this;
+            }
+
+            Vec2 spinned( T theta ) const {
+                return Vec2{ *this }.spin( theta );
+            }
+
+        public:
+            bool is_further_than( const Vec2& other, Heading heading ) const {
+                switch( heading ) {
+                    case Heading :: NORTH: return y > other.y;
+                    case Heading :: EAST:  return x > other.x;
+                    case Heading :: SOUTH: return y < other.y;
+                    case Heading :: WEST:  return x < other.x;
+                }
+
+                return false;
+            }
+
+        public:
+            template< typename R >
+            auto X( const Ray2& ray ) const;
+
+            template< typename R >
+            auto X( const Clust2& clust ) const;
+
+        public:
+            bool operator == ( const Vec2& other ) const {
+                return x == other.x && y == other.y;
+            }
+
+            Vec2 operator + ( const Vec2& other ) const {
+                return { x + other.x, y + other.y };
+            }
+
+            Vec2 operator - ( const Vec2& other ) const {
+                return { x - other.x, y - other.y };
+            }
+
+            Vec2 operator * ( const Vec2& other ) const {
+                return { x * other.x, y * other.y };
+            }
+
+            Vec2 operator / ( const Vec2& other ) const {
+                return { x / other.x, y / other.y };
+            }
+
+            Vec2 operator + ( T delta ) const {
+                return { x + delta, y + delta };
+            }
+
+            Vec2 operator - ( T delta ) const {
+                return { x - delta, y - delta };
+            }
+
+            Vec2 operator * ( T delta ) const {
+                return { x * delta, y * delta };
+            }
+
+            Vec2 operator / ( T delta ) const {
+                return { x / delta, y / delta };
+            }
+
+            Vec2 operator >> ( T delta ) const {
+                return { x + delta, y };
+            }
+
+            Vec2 operator ^ ( T delta ) const {
+                return { x, y + delta };
+            }
+
+            Vec2& operator += ( const Vec2& other ) {
+                x += other.x;
+                y += other.y;
+
+                return *this;
+            }
+
+            Vec2& operator -= ( const Vec2& other ) {
+                x -= other.x;
+                y -= other.y;
+
+                return *this;
+            }
+
+            Vec2& operator *= ( const Vec2& other ) {
+                x *= other.x;
+                y *= other.y;
+
+                return *this;
+            }
+
+            Vec2& operator /= ( const Vec2& other ) {
+                x /= other.x;
+                y /= other.y;
+
+                return *this;
+            }
+
+            Vec2& operator *= ( T delta ) {
+                x *= delta;
+                y *= delta;
+
+                return *this;
+            }
+
+            Vec2& operator /= ( T delta ) {
+                x /= delta;
+                y /= delta;
+
+                return *this;
+            }
+
+            Vec2& operator >>= ( T delta ) {
+                x += delta;
+
+                return *this;
+            }
+
+            Vec2& operator ^= ( T delta ) {
+                y += delta;
+
+                return *this;
+            }
+
+            Vec2 operator - () const {
+                return ( *this ) * -1.0;
+            }
+
+        public:
+            static Vec2 O() {
+                return { 0.0, 0.0 };
+            }
+
+        public:
+            void render( Ref< Renderer > renderer, Ref< Is_brush auto > brush ) const;
+
+        };
+
+
+
+
+        template< typename T >
+        struct Hit2_t {
+            typedef   Vec2_t< T >     Vec2;
+            typedef   Clust2_t< T >   Clust2;
+
+            inline static constexpr size_t   NONE   = ~size_t{ 0 };
+
+            T               t          = Scalar< T > :: inf();
+            T               distance   = Scalar< T > :: inf();
+            Vec2            point      = {};
+            size_t          edge       = NONE;
+            const Clust2*   clust      = nullptr;
+
+            operator bool () const {
+                return edge != NONE;
+            }
+        };
+
+        /* Ids index the swept span, first below second. Collinear overlaps report where the overlap starts. */
+        template< typename T >
+        struct Crossing2_t {
+            typedef   Vec2_t< T >   Vec2;
+
+            Vec2     point        = {};
+            size_t   first        = 0;
+            size_t   second       = 0;
+            bool     collinear    = false;
+        };
+
+    
+
+        template< typename T >
+        class Ray2_t {
+        public:
+            typedef   Vec2_t< T >        Vec2;
+            typedef   Ray2_t             Ray2;
+            typedef   Box2_t< T >        Box2;
+            typedef   Clust2_t< T >      Clust2;
+            typedef   Hit2_t< T >        Hit2;
+            typedef   Crossing2_t< T >   Crossing2;
+
+        public:
+            Ray2_t() = default;
+
+            Ray2_t( Vec2 org, Vec2 v )
+                : origin( org ), vec( v ) 
+            {}
+
+            template< typename U >
+            requires ( !std :: is_same_v< T, U > )
+            explicit Ray2_t( const Ray2_t< U >& other )
+                : origin( other.origin ), vec( other.vec )
+            {}
+
+        public:
+            Vec2   origin   = {};
+            Vec2   vec      = {};
+
+        public:
+            Vec2 end() const {
+                return origin + vec;
+            }
+
+        public:
+            /* Vertical rays report an infinite slope signed by their direction. */
+            T slope() const {
+                if( vec.x == 0.0 ) return vec.y < 0.0 ? -Scalar< T > :: inf() : Scalar< T > :: inf();
+
+                return vec.y / vec.x;
+            }
+
+            std :: tuple< T, T, T > coeffs() const {
+                return { vec.y, -vec.x, vec.y * origin.x - vec.x * origin.y };
+            }
+
+        public:
+            template< typename R >
+            auto X( const Vec2& vec ) const {
+                return this -> X< R >( Ray2{ Vec2 :: O(), vec } );
+            }
+
+            template< typename R >
+            auto X( const Ray2& other ) const {
+                if constexpr( std :: is_same_v< bool, R > ) 
+                    return _intersect_vec( other ).has_value();
+                else
+                    return _intersect_vec( other );
+            }
+
+            /* Parallel, on one line and sharing at least a point. */
+            bool Xprll( const Ray2& other ) const {
+                if( vec.x * other.vec.y - vec.y * other.vec.x != 0.0 ) return false;
+
+                const Vec2 offs = other.origin - origin;
+
+                if( vec.x * offs.y - vec.y * offs.x != 0.0 ) return false;
+
+                const T len_sq = vec.dot( vec );
+
+                if( len_sq == 0.0 ) 
+                    return other.vec.dot( other.vec ) == 0.0 ? offs.dot( offs ) == 0.0 : other.Xprll( *this );
+
+                T t0 = offs.dot( vec ) / len_sq;
+                T t1 = ( offs + other.vec ).dot( vec ) / len_sq;
+
+                if( t0 > t1 ) std :: swap( t0, t1 );
+
+                return t0 <= 1.0 && t1 >= 0.0;
+            }
+
+            template< typename R >
+            auto X( const Clust2& clust ) const;
+
+        public:
+            inline static constexpr size_t   PACKET   = 64;
+
+            static void cast( std :: span< const Ray2 > rays, std :: span< const Ray2 > edges, std :: span< Hit2 > hits ) {
+                static_assert( sizeof( Ray2 ) == 4 * sizeof( T ) && std :: is_standard_layout_v< Ray2 >, "Kernels read rays as four packed scalars." );
+
+                const size_t count = std :: min( rays.size(), hits.size() );
+
+                for( size_t begin = 0; begin < count; begin += PACKET ) {
+                    const size_t n = std :: min( PACKET, count - begin );
+
+                    T t[ PACKET ];
+                    size_t edge[ PACKET ];
+                    size_t tag[ PACKET ];
+
+                    std :: fill_n( t, n, 1.0 );
+                    std :: fill_n( edge, n, Hit2 :: NONE );
+
+                    Simd :: strike( 
+                        reinterpret_cast< const T* >( edges.data() ), edges.size(),
+                        reinterpret_cast< const T* >( rays.data() + begin ), n,
+                        t, edge, tag, 0
+                    );
+
+                    _emit( rays.data() + begin, hits.data() + begin, n, t, edge, [] ( size_t ) -> const Clust2* { return nullptr; } );
+                }
+            }
+
+            static void cast( std :: span< const Ray2 > rays, std :: span< const Clust2* const > obstacles, std :: span< Hit2 > hits );
+
+            static std :: vector< Crossing2 > crossings( std :: span< const Ray2 > rays, bool endpoints = false );
+
+        private:
+            template< typename F >
+            static void _emit( const Ray2* rays, Hit2* hits, size_t count, const T* t, const size_t* edge, F&& owner ) {
+                for( size_t idx = 0; idx < count; ++idx ) {
+                    if( edge[ idx ] == Hit2 :: NONE ) {
+                        hits[ idx ] = Hit2{};
+
+                        continue;
+                    }
+
+                    hits[ idx ].t        = t[ idx ];
+                    hits[ idx ].distance = t[ idx ] * rays[ idx ].vec.mag();
+                    hits[ idx ].point    = rays[ idx ].origin + rays[ idx ].vec * t[ idx ];
+                    hits[ idx ].edge     = edge[ idx ];
+                    hits[ idx ].clust    = owner( idx );
+                }
+            }
+
+        private:
+            std :: optional< Vec2 > _intersect_vec( const Ray2& other ) const {
+                /* Hai noroc nea' Peter +respect. */
+
+                auto [ alpha, bravo, charlie ] = coeffs();
+                auto [ delta, echo, foxtrot ] = other.coeffs();
+
+                T golf = alpha * echo - bravo * delta;
+
+                if( golf == 0.0 ) return {};
+
+                Vec2 int_vec = {
+                    ( charlie * echo - bravo * foxtrot ) / golf,
+                    ( alpha * foxtrot - delta * charlie ) / golf
+                };
+
+                Vec2 normalized = int_vec( origin ) / vec;
+                
+                if( !( ( normalized.x >= 0.0 && normalized.x <= 1.0 )
+                    ||
+                    ( normalized.y >= 0.0 && normalized.y <= 1.0 ) )
+                ) return {};
+
+                normalized = int_vec( other.origin ) / other.vec;
+
+                if( !( ( normalized.x >= 0.0 && normalized.x <= 1.0 )
+                    ||
+                    ( normalized.y >= 0.0 && normalized.y <= 1.0 ) )
+                ) return {};
+
+                return int_vec;
+            }
+
+        public:
+            void render( Ref< Renderer > renderer, Ref< Is_brush auto > brush ) const;
+
+        };
+
+
+
+        template< typename T >
+        class Box2_t {
+        public:
+            typedef   Vec2_t< T >     Vec2;
+            typedef   Ray2_t< T >     Ray2;
+            typedef   Box2_t          Box2;
+
+        public:
+            Box2_t() = default;
+
+            Box2_t( Vec2 min, Vec2 max )
+                : min( min ), max( max )
+            {}
+
+            template< typename U >
+            requires ( !std :: is_same_v< T, U > )
+            explicit Box2_t( const Box2_t< U >& other )
+                : min( other.min ), max( other.max )
+            {}
+
+        public:
+            Vec2   min   = {};
+            Vec2   max   = {};
+
+        public:
+            Vec2 center() const {
+                return ( min + max ) / 2.0;
+            }
+
+            Vec2 extent() const {
+                return max - min;
+            }
+
+            T perimeter() const {
+                return 2.0 * ( ( max.x - min.x ) + ( max.y - min.y ) );
+            }
+
+        public:
+            bool overlaps( const Box2& other ) const {
+                return min.x <= other.max.x && other.min.x <= max.x
+                       &&
+                       min.y <= other.max.y && other.min.y <= max.y;
+            }
+
+            bool contains( const Box2& other ) const {
+                return min.x <= other.min.x && min.y <= other.min.y
+                       &&
+                       other.max.x <= max.x && other.max.y <= max.y;
+            }
+
+            bool contains( const Vec2& vec ) const {
+                return min.x <= vec.x && vec.x <= max.x 
+                       && 
+                       min.y <= vec.y && vec.y <= max.y;
+            }
+
+        public:
+            Box2 merged( const Box2& other ) const {
+                return {
+                    { std :: min( min.x, other.min.x ), std :: min( min.y, other.min.y ) },
+                    { std :: max( max.x, other.max.x ), std :: max( max.y, other.max.y ) }
+                };
+            }
+
+            Box2 fattened( T margin ) const {
+                return { min - margin, max + margin };
+            }
+
+        public:
+            std :: optional< T > strike( const Ray2& ray ) const {
+                T t_in  = 0.0;
+                T t_out = 1.0;
+
+                const T org[ 2 ] = { ray.origin.x, ray.origin.y };
+                const T dir[ 2 ] = { ray.vec.x, ray.vec.y };
+                const T lo[ 2 ]  = { min.x, min.y };
+                const T hi[ 2 ]  = { max.x, max.y };
+
+                for( size_t axis = 0; axis < 2; ++axis ) {
+                    if( dir[ axis ] == 0.0 ) {
+                        if( org[ axis ] < lo[ axis ] || org[ axis ] > hi[ axis ] ) return {};
+
+                        continue;
+                    }
+
+                    T t1 = ( lo[ axis ] - org[ axis ] ) / dir[ axis ];
+                    T t2 = ( hi[ axis ] - org[ axis ] ) / dir[ axis ];
+
+                    if( t1 > t2 ) std :: swap( t1, t2 );
+
+                    t_in  = std :: max( t_in, t1 );
+                    t_out = std :: min( t_out, t2 );
+
+                    if( t_in > t_out ) return {};
+                }
+
+                return t_in;
+            }
+
+        };
+
+
+
+        template< typename T >
+        struct Contact2_t {
+            typedef   Vec2_t< T >   Vec2;
+
+            Vec2     normal       = {};
+            T        depth        = 0.0;
+
+            Vec2     points[ 2 ]  = {};
+            T        depths[ 2 ]  = {};
+            size_t   count        = 0;
+        };
+
+        template< typename T >
+        struct Proximity2_t {
+            typedef   Vec2_t< T >   Vec2;
+
+            T        distance     = 0.0;
+
+            Vec2     closest      = {};
+            Vec2     other_closest = {};
+
+            bool     overlap      = false;
+        };
+
+        template< typename T >
+        struct Motion2_t {
+            typedef   Vec2_t< T >   Vec2;
+
+            Vec2     linear       = {};
+            T        angular      = 0.0;
+        };
+
+        template< typename T >
+        struct Impact2_t {
+            typedef   Vec2_t< T >   Vec2;
+
+            T        t            = 0.0;
+            Vec2     normal       = {};
+            Vec2     point        = {};
+        };
+
+        template< typename T >
+        struct Mass2_t {
+            typedef   Vec2_t< T >   Vec2;
+
+            T        mass         = 0.0;
+            Vec2     center       = {};
+            T        inertia      = 0.0;
+        };
+
+        /* Negative distance inside the outline. */
+        template< typename T >
+        struct Nearest2_t {
+            typedef   Vec2_t< T >   Vec2;
+
+            T        distance     = 0.0;
+            Vec2     closest      = {};
+            size_t   edge         = 0;
+        };
+
+        /* Outline wound counter-clockwise, holes clockwise. */
+        template< typename T >
+        struct Region2_t {
+            typedef   Clust2_t< T >   Clust2;
+
+            Clust2                    outline   = {};
+            std :: vector< Clust2 >   holes     = {};
+        };
+
+
+
+        template< typename T >
+        class Clust2_t {
+        public:
+            typedef   Vec2_t< T >          Vec2;
+            typedef   Ray2_t< T >          Ray2;
+            typedef   Box2_t< T >          Box2;
+            typedef   Clust2_t             Clust2;
+            typedef   Contact2_t< T >      Contact2;
+            typedef   Proximity2_t< T >    Proximity2;
+            typedef   Motion2_t< T >       Motion2;
+            typedef   Impact2_t< T >       Impact2;
+            typedef   Mass2_t< T >         Mass2;
+            typedef   Nearest2_t< T >      Nearest2;
+            typedef   Region2_t< T >       Region2;
+            typedef   Clip2_t< T >         Clip2;
+
+        private:
+            friend Ray2;
+
+            template< typename > friend class Clust2_t;
+
+        public:
+            Clust2_t() = default;
+
+            template< typename Iterator >
+            Clust2_t( Iterator begin, Iterator end ) {
+                _b_vrtx.reserve( std :: abs( std :: distance( begin, end ) ) );
+
+                for( ; begin != end; ++begin )
+                    _b_vrtx.push_back( *begin );
+
+                _vrtx = _b_vrtx;
+            }
+
+            template< typename Container >
+            Clust2_t( const Container& container )
+                : Clust2_t( container.begin(), container.end() )
+            {}
+
+            template< typename O, typename Iterator >
+            requires ( 
+                std :: is_same_v< std :: decay_t< O >, Vec2 > 
+                || 
+                std :: is_same_v< std :: decay_t< O >, Clust2* > 
+            )
+            Clust2_t( O org, Iterator begin, Iterator end, Vec2 offs = {} ) 
+                : Clust2_t( begin, end ) 
+            {
+                if constexpr( std :: is_same_v< O, Vec2 > )
+                    _origin = org;
+                else
+                    _origin = { org, offs };
+            }
+
+            template< typename O, typename Container >
+            requires ( 
+                std :: is_same_v< std :: decay_t< O >, Vec2 > 
+                || 
+                std :: is_same_v< std :: decay_t< O >, Clust2* > 
+            )
+            Clust2_t( O org, const Container& container, Vec2 offs = {} ) 
+                : Clust2_t( org, container.begin(), container.end(), offs )
+            {}
+
+            /* Hooks do not cross precisions, the copy lands detached at the world origin of the source. */
+            template< typename U >
+            requires ( !std :: is_same_v< T, U > )
+            explicit Clust2_t( const Clust2_t< U >& other )
+                : _origin( Vec2( other.origin() ) ),
+                  _scaleX( static_cast< T >( other._scaleX ) ),
+                  _scaleY( static_cast< T >( other._scaleY ) ),
+                  _angel ( static_cast< T >( other._angel ) )
+            {
+                _vrtx.reserve( other.vrtx_count() );
+                _b_vrtx.reserve( other.vrtx_count() );
+
+                for( size_t idx = 0; idx < other.vrtx_count(); ++idx ) {
+                    _vrtx.push_back( Vec2( std :: as_const( other._vrtx )[ idx ] ) );
+                    _b_vrtx.push_back( Vec2( std :: as_const( other._b_vrtx )[ idx ] ) );
+                }
+            }
+        
+        public:
+            Clust2_t( const Clust2_t& other )
+                : _origin( other._origin ),
+                  _vrtx  ( other._vrtx ),
+                  _b_vrtx( other._b_vrtx ),
+                  _scaleX( other._scaleX ),
+                  _scaleY( other._scaleY ),
+                  _angel ( other._angel ),
+                  _convex( other._convex ),
+                  _shape_dirty( other._shape_dirty ),
+                  _decomposed( other._decomposed ),
+                  _proxy ( other._proxy ? std :: make_unique< Clust2 >( *other._proxy ) : nullptr )
+            {
+                _link();
+            }
+
+            Clust2& operator = ( const Clust2& other ) { 
+                if( this == &other ) return *this;
+
+                _unlink();
+
+                _origin = other._origin;
+                _vrtx   = other._vrtx;
+                _b_vrtx = other._b_vrtx;
+                _scaleX = other._scaleX;
+                _scaleY = other._scaleY;
+                _angel  = other._angel;
+
+                _convex      = other._convex;
+                _shape_dirty = other._shape_dirty;
+                _local_dirty = _tris_dirty = _parts_dirty = true;
+
+                _decomposed = other._decomposed;
+
+                _proxy = other._proxy ? std :: make_unique< Clust2 >( *other._proxy ) : nullptr;
+
+                _link();
+                _touch();
+
+                return *this;
+            }
+
+            Clust2_t( Clust2_t&& other ) noexcept
+                : _origin( other._origin ),
+                  _vrtx  ( std :: move( other._vrtx ) ),
+                  _b_vrtx( std :: move( other._b_vrtx ) ),
+                  _scaleX( other._scaleX ),
+                  _scaleY( other._scaleY ),
+                  _angel ( other._angel ),
+                  _convex( other._convex ),
+                  _shape_dirty( other._shape_dirty ),
+                  _decomposed( other._decomposed ),
+                  _proxy ( std :: move( other._proxy ) )
+            {
+                _link();
+                _adopt( other );
+                _touch();
+            }
+
+            Clust2& operator = ( Clust2&& other ) noexcept { 
+                if( this == &other ) return *this;
+
+                _unlink();
+
+                _origin = other._origin;
+                _vrtx   = std :: move( other._vrtx );
+                _b_vrtx = std :: move( other._b_vrtx );
+                _scaleX = other._scaleX;
+                _scaleY = other._scaleY;
+                _angel  = other._angel;
+
+                _convex      = other._convex;
+                _shape_dirty = other._shape_dirty;
+                _local_dirty = _tris_dirty = _parts_dirty = true;
+
+                _decomposed = other._decomposed;
+
+                _proxy = std :: move( other._proxy );
+
+                _link();
+                _adopt( other );
+                _touch();
+
+                return *this;
+            }
+
+            ~Clust2_t() {
+                _unlink();
+
+                for( Clust2* clust : _hooked ) {
+                    clust -> _origin = clust -> origin();
+                    clust -> _touch();
+                }
+            }
+
+        public:
+            class Vrtx_ref {
+            public:
+                Vrtx_ref( T& x, T& y )
+                    : x( x ), y( y )
+                {}
+
+                Vrtx_ref( const Vrtx_ref& other ) = default;
+
+            public:
+                T&   x;
+                T&   y;
+
+            public:
+                operator Vec2 () const {
+                    return { x, y };
+                }
+
+            public:
+                Vrtx_ref& operator = ( const Vrtx_ref& other ) {
+                    return *this = Vec2{ other };
+                }
+
+                Vrtx_ref& operator = ( const Vec2& vec ) {
+                    x = vec.x;
+                    y = vec.y;
+
+                    return *this;
+                }
+
+                Vrtx_ref& operator += ( const Vec2& vec ) {
+                    return *this = Vec2{ *this } + vec;
+                }
+
+                Vrtx_ref& operator -= ( const Vec2& vec ) {
+                    return *this = Vec2{ *this } - vec;
+                }
+
+                Vrtx_ref& operator *= ( const Vec2& vec ) {
+                    return *this = Vec2{ *this } * vec;
+                }
+
+                Vrtx_ref& operator /= ( const Vec2& vec ) {
+                    return *this = Vec2{ *this } / vec;
+                }
+
+            };
+
+        private:
+            struct Lanes {
+                std :: vector< T >   x   = {};
+                std :: vector< T >   y   = {};
+
+                size_t size() const {
+                    return x.size();
+                }
+
+                void reserve( size_t count ) {
+                    x.reserve( count );
+                    y.reserve( count );
+                }
+
+                void push_back( const Vec2& vec ) {
+                    x.push_back( vec.x );
+                    y.push_back( vec.y );
+                }
+
+                Vrtx_ref operator [] ( size_t idx ) {
+                    return { x[ idx ], y[ idx ] };
+                }
+
+                Vec2 operator [] ( size_t idx ) const {
+                    return { x[ idx ], y[ idx ] };
+                }
+            };
+
+            struct Edges {
+                std :: vector< T >   ax      = {};
+                std :: vector< T >   ay      = {};
+                std :: vector< T >   by      = {};
+                std :: vector< T >   slope   = {};
+                std :: vector< Ray2 >     rays    = {};
+            };
+
+        private:
+            typedef   std :: variant< Vec2, std :: pair< Clust2*, Vec2 > >   Origin;
+
+            enum ORIGIN_VARIANT_ACCESS_INDEX {
+                VEC = 0,
+                HOOK = 1
+            };
+
+        private:
+            Origin   _origin   = Vec2{ 0.0, 0.0 };
+            Lanes    _vrtx     = {};
+            Lanes    _b_vrtx   = {};
+
+            T        _scaleX   = 1.0;
+            T        _scaleY   = 1.0;
+            T        _angel    = 0.0;
+
+            mutable bool   _convex        = false;
+            mutable bool   _shape_dirty   = true;
+
+            mutable Lanes  _w_vrtx        = {};
+            mutable Box2   _l_box         = {};
+            mutable Box2   _w_box         = {};
+            mutable Vec2   _w_origin      = {};
+            mutable bool   _local_dirty   = true;
+            mutable bool   _world_dirty   = true;
+
+            mutable Edges  _w_edges       = {};
+            mutable bool   _edges_dirty   = true;
+
+            mutable Vec2   _h_origin      = {};
+            mutable bool   _h_dirty       = true;
+
+            mutable std :: vector< uint32_t >   _tris         = {};
+            mutable std :: vector< T >          _tri_areas    = {};
+            mutable bool                        _tris_dirty   = true;
+
+            mutable std :: vector< Clust2 >     _parts        = {};
+            mutable bool                        _parts_dirty  = true;
+            bool                                _decomposed   = false;
+
+            std :: vector< Clust2* >   _hooked   = {};
+            std :: unique_ptr< Clust2 >   _proxy   = nullptr;
+
+        public:
+            Vec2 origin() const {
+                if( !is_hooked() ) return std :: get< VEC >( _origin );
+
+                if( _h_dirty ) {
+                    const auto& [ hook, offs ] = std :: get< HOOK >( _origin );
+
+                    _h_origin = hook -> origin() + offs;
+                    _h_dirty  = false;
+                }
+
+                return _h_origin;
+            }
+
+            /* Marks the hooked subtree dirty up front, so hold the reference only for the write it was taken for. */
+            Vec2& origin_ref() {
+                if( is_hooked() ) return hook().origin_ref();
+
+                _touch();
+
+                return std :: get< VEC >( _origin );
+            }
+
+            operator Vec2 () const {
+                return origin();
+            }
+
+            Vec2 operator () () const {
+                return this -> operator Vec2 ();
+            }
+
+        public:
+            bool is_hooked() const {
+                return _origin.index() == HOOK;
+            }
+
+            bool is_hookable_to( Clust2& other ) {
+                for( Clust2* clust = &other; clust -> is_hooked(); clust = &clust -> hook() )
+                    if( &clust -> hook() == this ) 
+                        return false;
+
+                return true;
+            }
+
+            Vec2& hook_offs() {
+                _touch();
+
+                return std :: get< HOOK >( _origin ).second;
+            }
+
+            Clust2& hook_offs_to( const Vec2& vec ) {
+                hook_offs() = vec;
+
+                return *this;
+            }
+
+            Clust2& hook() {
+                return *std :: get< HOOK >( _origin ).first;
+            }
+
+            Clust2& hook_to( Clust2& other, std :: optional< Vec2 > offs = {} ) {
+                Vec2 hook_offs = offs.value_or( origin()( other.origin() ) );
+
+                _unlink();
+
+                _origin = std :: make_pair( &other, hook_offs );
+
+                _link();
+                _touch();
+
+                return *this;
+            }
+
+            Clust2& dehook() {
+                Vec2 org = origin();
+
+                _unlink();
+
+                _origin = org;
+
+                _touch();
+
+                return *this;
+            }
+
+        public:
+            /*
+                Brings the lazy caches of this outline and its hooked tree up to date: world vertices, box,
+                edges, the collider and its parts. Const queries only read after this, so a moved outline
+                must be settled before several threads query it at once.
+            */
+            const Clust2& settle() const {
+                const Clust2& coll = collider();
+
+                _sync_edges();
+                coll._sync_edges();
+
+                if( coll._uses_parts() )
+                    for( const Clust2& part : coll.parts() ) part._sync_edges();
+
+                for( Clust2* clust : _hooked )
+                    clust -> settle();
+
+                return *this;
+            }
+
+            static void settle( std :: span< Clust2* const > clusts, size_t thread_count = 1 ) {
+                std :: vector< Clust2* > roots{};
+
+                roots.reserve( clusts.size() );
+
+                for( Clust2* clust : clusts ) {
+                    while( clust -> is_hooked() ) clust = &clust -> hook();
+
+                    roots.push_back( clust );
+                }
+
+                std :: sort( roots.begin(), roots.end() );
+                roots.erase( std :: unique( roots.begin(), roots.end() ), roots.end() );
+
+                parallel_for( roots.size(), thread_count, [ &roots ] ( size_t begin, size_t end ) -> void {
+                    for( size_t idx = begin; idx < end; ++idx )
+                        roots[ idx ] -> settle();
+                } );
+            }
+
+        private:
+            void _link() {
+                if( is_hooked() ) 
+                    hook()._hooked.push_back( this );
+            }
+
+            void _unlink() {
+                if( is_hooked() ) 
+                    std :: erase( hook()._hooked, this );
+            }
+
+            void _adopt( Clust2& other ) {
+                for( Clust2* clust : other._hooked ) {
+                    std :: get< HOOK >( clust -> _origin ).first = this;
+
+                    _hooked.push_back( clust );
+                }
+
+                other._hooked.clear();
+            }
+
+            void _touch() const {
+                _h_dirty = true;
+
+                for( Clust2* clust : _hooked )
+                    if( !clust -> _h_dirty ) 
+                        clust -> _touch();
+            }
+
+        public:
+            Vrtx_ref b_vrtx( size_t idx ) {
+                _shape_dirty = _local_dirty = _tris_dirty = _parts_dirty = true;
+
+                return _b_vrtx[ idx ];
+            }
+
+            Vrtx_ref operator [] ( size_t idx ) {
+                _shape_dirty = _local_dirty = _tris_dirty = _parts_dirty = true;
+
+                return _vrtx[ idx ];
+            }
+
+            Vec2 operator() ( size_t idx ) const {
+                _sync();
+
+                return std :: as_const( _w_vrtx )[ idx ];
+            }
+
+            size_t vrtx_count() const {
+                return _vrtx.size();
+            }
+
+        public:
+            T angel() const {
+                return _angel;
+            }
+
+            T scaleX() const {
+                return _scaleX;
+            }
+
+            T scaleY() const {
+                return _scaleY;
+            }
+
+            T scale() const {
+                return scaleX();
+            }
+
+        public:
+            Clust2& operator = ( const Vec2& vec ) {
+                return relocate( vec );
+            }
+
+            Clust2& relocate( const Vec2& vec ) {
+                origin_ref() = vec;
+
+                return *this;
+            }
+
+            Clust2& relocate_by( size_t idx, const Vec2& vec ) {
+                origin_ref() += vec.respect_to( this -> operator()( idx ) );
+
+                return *this;
+            }
+
+        public:
+            Clust2& spin_with( T theta ) {
+                _angel += theta;
+
+                _refresh();
+
+                return *this;
+            }
+
+            Clust2& spin_at( T theta ) {
+                _angel = theta;
+
+                _refresh();
+
+                return *this;
+            }
+
+            Clust2& scaleX_with( T delta ) {
+                _scaleX *= delta;
+
+                _refresh();
+
+                return *this;
+            }
+
+            Clust2& scaleY_with( T delta ) {
+                _scaleY *= delta;
+
+                _refresh();
+
+                return *this;
+            }
+
+            Clust2& scale_with( T delta ) {
+                _scaleX *= delta;
+                _scaleY *= delta;
+
+                _refresh();
+
+                return *this;
+            }
+
+            Clust2& scaleX_at( T delta ) {
+                _scaleX = delta;
+
+                _refresh();
+
+                return *this;
+            }
+
+            Clust2& scaleY_at( T delta ) {
+                _scaleY = delta;
+
+                _refresh();
+
+                return *this;
+            }
+
+            Clust2& scale_at( T delta ) {
+                _scaleX = _scaleY = delta;
+
+                _refresh();
+
+                return *this;
+            }
+
+        public:
+            static Clust2 triangle( T edge_length ) {
+                Vec2 vrtx = { 0.0, edge_length * Scalar< T > :: sqrt( T( 3 ) ) / T( 3 ) };
+
+                return std :: vector< Vec2 >( {
+                    vrtx,
+                    vrtx.spinned( 120.0 ),
+                    vrtx.spinned( -120.0 )
+                } );
+            }
+
+            static Clust2 square( T edge_length ) {
+                edge_length /= 2.0;
+
+                return std :: vector< Vec2 >( {
+                    { edge_length, edge_length },
+                    { edge_length, -edge_length },
+                    { -edge_length, -edge_length },
+                    { -edge_length, edge_length }
+                } );
+            }
+
+            static Clust2 circle( T radius, size_t precision ) {
+                std :: vector< Vec2 > vrtx;
+                vrtx.reserve( precision );
+
+                vrtx.emplace_back( 0.0, radius );
+
+                for( size_t n = 1; n < precision; ++n )
+                    vrtx.push_back( vrtx.front().spinned( 360.0 / precision * n ) );
+
+                return vrtx;
+            }
+
+            static Clust2 rect( Vec2 tl, Vec2 br ) {
+                return std :: vector< Vec2 >( {
+                    tl, Vec2( br.x, tl.y ), br, Vec2( tl.x, br.y )
+                } );
+            }
+
+            template< typename G >
+            requires std :: is_invocable_v< G >
+            static Clust2 random( 
+                T min_dist, T max_dist, 
+                size_t min_ec, size_t max_ec, 
+                G&& generator 
+            ) {
+                /* Xoshiro256 draws from its top 53 bits, other generators keep the modulo draw so their shapes stay as they were. */
+                static auto scalar = [] ( auto& generator, T min ) -> T {
+                    if constexpr( std :: is_same_v< std :: decay_t< decltype( generator ) >, Xoshiro256 > )
+                        return static_cast< T >( generator.unit() ) * ( T( 1 ) - min ) + min;
+                    else
+                        return ( static_cast< T >( std :: invoke( generator ) % 10001 ) / 10000 )
+                               * ( 1.0 - min ) + min;
+                };
+
+                size_t edge_count = std :: invoke( generator ) % ( max_ec - min_ec + 1 ) + min_ec;
+
+                std :: vector< Vec2 > vrtx{};
+                vrtx.reserve( edge_count );
+
+                vrtx.emplace_back( 0.0, max_dist );
+
+                const T diff  = 360.0 / edge_count;
+                const T ratio = min_dist / max_dist;
+
+                for( size_t n = 1; n < edge_count; ++n ) {
+                    T theta = Rad :: pull( diff * n + ( scalar( generator, ratio ) - 0.5 ) * diff );
+                    T dist  = max_dist * scalar( generator, ratio );
+
+                    vrtx.emplace_back( -Scalar< T > :: sin( theta ) * dist, Scalar< T > :: cos( theta ) * dist );
+                }
+
+                return vrtx;
+            }
+
+            /* 
+                Shapes are drawn in fixed blocks, block b from the seed's stream jumped b times, 
+                so the output only depends on the seed and never on the thread count.
+            */
+            static std :: vector< Clust2 > random_m( 
+                size_t count,
+                T min_dist, T max_dist, 
+                size_t min_ec, size_t max_ec, 
+                uint64_t seed,
+                size_t thread_count = 1
+            ) {
+                static constexpr size_t BLOCK = 64;
+
+                std :: vector< Clust2 > clusts( count );
+
+                parallel_for( ( count + BLOCK - 1 ) / BLOCK, thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    Xoshiro256 stream = Xoshiro256{ seed }.jumped( begin );
+
+                    for( size_t block = begin; block < end; ++block, stream.jump() ) {
+                        Xoshiro256 rng = stream;
+
+                        for( size_t idx = block * BLOCK; idx < std :: min( count, ( block + 1 ) * BLOCK ); ++idx )
+                            clusts[ idx ] = random( min_dist, max_dist, min_ec, max_ec, rng );
+                    }
+                } );
+
+                return clusts;
+            }
+
+            //static Clust2 sprite( View< Sprite > sprite );
+
+        public:
+            template< Word W >
+            requires ( W == REF || W == IDX )
+            typename std :: conditional_t< W == REF, Vrtx_ref, size_t > extreme( Heading heading ) {
+                size_t ex_idx = 0;
+
+                for( size_t idx = 0; idx < vrtx_count(); ++idx )
+                    if( std :: as_const( _vrtx )[ idx ].is_further_than( std :: as_const( _vrtx )[ ex_idx ], heading ) )
+                        ex_idx = idx;
+
+                if constexpr( W == REF ) {
+                    _shape_dirty = _local_dirty = _tris_dirty = _parts_dirty = true;
+
+                    return _vrtx[ ex_idx ];
+                } else
+                    return ex_idx;
+            }
+
+            Vec2 extreme( Heading heading, System system = GLOBAL ) const {
+                return _vrtx[ const_cast< Clust2* >( this ) -> extreme< IDX >( heading ) ]
+                       + 
+                       ( system == GLOBAL ? origin() : Vec2 :: O() );
+            }
+
+            template< Word W >
+            requires ( W == IDX )
+            size_t extreme( const Vec2& dir ) const {
+                size_t ex_idx = 0;
+                T ex_dot = -Scalar< T > :: inf();
+
+                for( size_t idx = 0; idx < vrtx_count(); ++idx ) {
+                    T dot = _vrtx.x[ idx ] * dir.x + _vrtx.y[ idx ] * dir.y;
+
+                    if( dot > ex_dot ) {
+                        ex_dot = dot;
+                        ex_idx = idx;
+                    }
+                }
+
+                return ex_idx;
+            }
+
+            Vec2 extreme( const Vec2& dir, System system = GLOBAL ) const {
+                return _vrtx[ extreme< IDX >( dir ) ] + ( system == GLOBAL ? origin() : Vec2 :: O() );
+            }
+
+            Box2 box( System system = GLOBAL ) const {
+                _sync();
+
+                return system == GLOBAL ? _w_box : _l_box;
+            }
+
+            T reach() const {
+                T reach_sq = 0.0;
+
+                for( size_t idx = 0; idx < vrtx_count(); ++idx )
+                    reach_sq = std :: max( reach_sq, std :: as_const( _vrtx )[ idx ].mag_sq() );
+
+                return Scalar< T > :: sqrt( reach_sq );
+            }
+
+            Clust2 snapshot() const {
+                std :: vector< Vec2 > vrtx{};
+                vrtx.reserve( vrtx_count() );
+
+                for( size_t idx = 0; idx < vrtx_count(); ++idx )
+                    vrtx.push_back( std :: as_const( _vrtx )[ idx ] );
+
+                return { origin(), vrtx };
+            }
+
+        public:
+            /* Ramer-Douglas-Peucker over the closed base outline, tolerance in outline units before scaling. */
+            Clust2 simplified( T tolerance ) const {
+                const size_t n = vrtx_count();
+
+                if( n <= 3 ) return _derive( _base() );
+
+                const Lanes& b_vrtx = _b_vrtx;
+
+                size_t far = 0;
+
+                for( size_t idx = 1; idx < n; ++idx )
+                    if( b_vrtx[ idx ].dist_sq_to( b_vrtx[ 0 ] ) > b_vrtx[ far ].dist_sq_to( b_vrtx[ 0 ] ) )
+                        far = idx;
+
+                std :: vector< bool >                          keep( n, false );
+                std :: vector< std :: pair< size_t, size_t > > spans{ { 0, far }, { far, n } };
+
+                keep[ 0 ] = keep[ far ] = true;
+
+                const T tol_sq = tolerance * tolerance;
+
+                T      worst_sq  = -1.0;
+                size_t worst     = 0;
+
+                while( !spans.empty() ) {
+                    auto [ lo, hi ] = spans.back();
+                    spans.pop_back();
+
+                    if( hi - lo < 2 ) continue;
+
+                    const Vec2 a = b_vrtx[ lo ];
+                    const Vec2 b = b_vrtx[ hi % n ];
+
+                    T      split_sq = -1.0;
+                    size_t split    = lo;
+
+                    for( size_t idx = lo + 1; idx < hi; ++idx ) {
+                        T d_sq = _seg_dist_sq( b_vrtx[ idx ], a, b );
+
+                        if( d_sq > split_sq ) { split_sq = d_sq; split = idx; }
+                    }
+
+                    if( split_sq > worst_sq ) { worst_sq = split_sq; worst = split; }
+
+                    if( split_sq <= tol_sq ) continue;
+
+                    keep[ split ] = true;
+
+                    spans.push_back( { lo, split } );
+                    spans.push_back( { split, hi } );
+                }
+
+                if( std :: count( keep.begin(), keep.end(), true ) < 3 && worst_sq > 0.0 )
+                    keep[ worst ] = true;
+
+                std :: vector< Vec2 > vrtx{};
+
+                for( size_t idx = 0; idx < n; ++idx )
+                    if( keep[ idx ] ) vrtx.push_back( b_vrtx[ idx ] );
+
+                return _derive( std :: move( vrtx ) );
+            }
+
+            /* Andrew's monotone chain over the base outline. */
+            Clust2 hull() const {
+                std :: vector< Vec2 > pts = _base();
+
+                if( pts.size() < 3 ) return _derive( std :: move( pts ) );
+
+                std :: sort( pts.begin(), pts.end(), [] ( const Vec2& a, const Vec2& b ) -> bool {
+                    return a.x < b.x || ( a.x == b.x && a.y < b.y );
+                } );
+
+                auto turn = [] ( const Vec2& o, const Vec2& a, const Vec2& b ) -> T {
+                    return ( a.x - o.x ) * ( b.y - o.y ) - ( a.y - o.y ) * ( b.x - o.x );
+                };
+
+                std :: vector< Vec2 > vrtx( 2 * pts.size() );
+                size_t                count = 0;
+
+                for( size_t idx = 0; idx < pts.size(); ++idx ) {
+                    while( count >= 2 && turn( vrtx[ count - 2 ], vrtx[ count - 1 ], pts[ idx ] ) <= 0.0 ) --count;
+
+                    vrtx[ count++ ] = pts[ idx ];
+                }
+
+                for( size_t idx = pts.size() - 1, lower = count + 1; idx-- > 0; ) {
+                    while( count >= lower && turn( vrtx[ count - 2 ], vrtx[ count - 1 ], pts[ idx ] ) <= 0.0 ) --count;
+
+                    vrtx[ count++ ] = pts[ idx ];
+                }
+
+                vrtx.resize( count - 1 );
+
+                return _derive( std :: move( vrtx ) );
+            }
+
+        public:
+            /* 
+                The proxy follows this outline's origin, spin and scale, and stands in for it
+                wherever collision goes through collider(). Outline edits do not rebuild it.
+            */
+            Clust2& proxy_with( T tolerance, bool convex = true ) {
+                Clust2 proxy = simplified( tolerance );
+
+                if( convex ) proxy = proxy.hull();
+
+                proxy._origin = origin();
+
+                _proxy = std :: make_unique< Clust2 >( std :: move( proxy ) );
+
+                return *this;
+            }
+
+            Clust2& deproxy() {
+                _proxy.reset();
+
+                return *this;
+            }
+
+            bool has_proxy() const {
+                return _proxy != nullptr;
+            }
+
+            const Clust2& collider() const {
+                if( !_proxy ) return *this;
+
+                const Vec2 org = origin();
+
+                if( !( std :: get< VEC >( _proxy -> _origin ) == org ) )
+                    _proxy -> _origin = org;
+
+                return *_proxy;
+            }
+
+        public:
+            /*
+                Concave outlines split into few convex parts, Hertel-Mehlhorn over the triangulation.
+                Once decomposed, overlap and contact tests run part against part behind box checks.
+                Parts follow spin and scale, and are only rebuilt after the outline itself is edited.
+            */
+            Clust2& decompose( bool enable = true ) {
+                _decomposed = enable;
+
+                if( enable ) 
+                    parts();
+                else {
+                    _parts.clear();
+                    _parts_dirty = true;
+                }
+
+                return *this;
+            }
+
+            bool is_decomposed() const {
+                return _decomposed;
+            }
+
+            std :: span< const Clust2 > parts() const {
+                if( _parts_dirty ) _decompose();
+
+                const Vec2 org = origin();
+
+                for( Clust2& part : _parts )
+                    if( !( std :: get< VEC >( part._origin ) == org ) ) part._origin = org;
+
+                return _parts;
+            }
+
+        public:
+            /* 
+                Index triples into the vertices. Spin and scale keep the topology, so the buffer 
+                is only rebuilt after the outline itself is edited.
+            */
+            std :: span< const uint32_t > triangles() const {
+                if( _tris_dirty ) _triangulate();
+
+                return _tris;
+            }
+
+            T area() const {
+                const auto tris = triangles();
+
+                T area = 0.0;
+
+                for( size_t idx = 0; idx < tris.size(); idx += 3 )
+                    area += _tri_area( _vrtx[ tris[ idx ] ], _vrtx[ tris[ idx + 1 ] ], _vrtx[ tris[ idx + 2 ] ] );
+
+                return area;
+            }
+
+            Mass2 mass( T density = 1.0 ) const {
+                const auto tris = triangles();
+
+                Mass2 mass{};
+                T     inertia = 0.0;
+
+                for( size_t idx = 0; idx < tris.size(); idx += 3 ) {
+                    const Vec2 a = _vrtx[ tris[ idx ] ];
+                    const Vec2 b = _vrtx[ tris[ idx + 1 ] ];
+                    const Vec2 c = _vrtx[ tris[ idx + 2 ] ];
+
+                    const T m = _tri_area( a, b, c ) * density;
+
+                    mass.mass   += m;
+                    mass.center += ( a + b + c ) * ( m / T( 3 ) );
+
+                    inertia += m / T( 6 ) * ( a.mag_sq() + b.mag_sq() + c.mag_sq() + a.dot( b ) + b.dot( c ) + c.dot( a ) );
+                }
+
+                if( mass.mass > 0.0 ) mass.center /= mass.mass;
+
+                mass.inertia = inertia - mass.mass * mass.center.mag_sq();
+                mass.center += origin();
+
+                return mass;
+            }
+
+            /* Uniform over the area, weighted by the cached triangle areas. */
+            template< typename G >
+            requires std :: is_invocable_v< G >
+            Vec2 sample( G&& generator ) const {
+                static auto scalar = [] ( auto& generator ) -> T {
+                    return static_cast< T >( std :: invoke( generator ) % 1000001 ) / 1000000;
+                };
+
+                const auto tris = triangles();
+
+                if( tris.empty() ) return origin();
+
+                const T   pick = scalar( generator ) * _tri_areas.back();
+                size_t    tri  = std :: lower_bound( _tri_areas.begin(), _tri_areas.end(), pick ) - _tri_areas.begin();
+
+                tri = std :: min( tri, _tri_areas.size() - 1 ) * 3;
+
+                T u = scalar( generator );
+                T v = scalar( generator );
+
+                if( u + v > 1.0 ) { u = T( 1 ) - u; v = T( 1 ) - v; }
+
+                const Vec2 a = _vrtx[ tris[ tri ] ];
+
+                return origin() + a + ( Vec2( _vrtx[ tris[ tri + 1 ] ] ) - a ) * u + ( Vec2( _vrtx[ tris[ tri + 2 ] ] ) - a ) * v;
+            }
+
+        private:
+            /* Ear clipping, ears are only tested against the reflex vertices bucketed under their box. */
+            void _triangulate() const {
+                const size_t n = vrtx_count();
+
+                _tris.clear();
+                _tri_areas.clear();
+                _tris_dirty = false;
+
+                if( n < 3 ) return;
+
+                const Lanes& vrtx = _vrtx;
+
+                T winding = 0.0;
+
+                for( size_t idx = 0; idx < n; ++idx ) {
+                    const Vec2 a = vrtx[ idx ];
+                    const Vec2 b = vrtx[ ( idx + 1 ) % n ];
+
+                    winding += a.x * b.y - a.y * b.x;
+                }
+
+                const T orient = winding < 0.0 ? T( -1 ) : T( 1 );
+
+                std :: vector< uint32_t > prev( n );
+                std :: vector< uint32_t > next( n );
+                std :: vector< bool >     reflex( n, false );
+
+                _sync();
+
+                const size_t side   = std :: max< size_t >( 1, static_cast< size_t >( std :: sqrt( double( n ) ) / 2 ) );
+                const Vec2   extent = _l_box.extent();
+                const T      cell_x = extent.x > 0.0 ? extent.x / T( side ) : T( 1 );
+                const T      cell_y = extent.y > 0.0 ? extent.y / T( side ) : T( 1 );
+
+                std :: vector< std :: vector< uint32_t > > cells( side * side );
+
+                auto cell_of = [ & ] ( T v, T min, T size ) -> size_t {
+                    T c = ( v - min ) / size;
+
+                    return c <= 0.0 ? 0 : std :: min( static_cast< size_t >( c ), side - 1 );
+                };
+
+                for( size_t idx = 0; idx < n; ++idx ) {
+                    prev[ idx ] = ( idx + n - 1 ) % n;
+                    next[ idx ] = ( idx + 1 ) % n;
+                }
+
+                auto turn = [ & ] ( const Vec2& a, const Vec2& b, const Vec2& c ) -> T {
+                    return orient * ( ( b.x - a.x ) * ( c.y - b.y ) - ( b.y - a.y ) * ( c.x - b.x ) );
+                };
+
+                auto classify = [ & ] ( uint32_t idx ) -> void {
+                    bool was = reflex[ idx ];
+
+                    reflex[ idx ] = turn( vrtx[ prev[ idx ] ], vrtx[ idx ], vrtx[ next[ idx ] ] ) < 0.0;
+
+                    if( reflex[ idx ] && !was ) 
+                        cells[ cell_of( vrtx.y[ idx ], _l_box.min.y, cell_y ) * side + cell_of( vrtx.x[ idx ], _l_box.min.x, cell_x ) ].push_back( idx );
+                };
+
+                for( size_t idx = 0; idx < n; ++idx ) classify( idx );
+
+                auto is_ear = [ & ] ( uint32_t idx ) -> bool {
+                    if( reflex[ idx ] ) return false;
+
+                    const Vec2 a = vrtx[ prev[ idx ] ];
+                    const Vec2 b = vrtx[ idx ];
+                    const Vec2 c = vrtx[ next[ idx ] ];
+
+                    const size_t x0 = cell_of( std :: min( { a.x, b.x, c.x } ), _l_box.min.x, cell_x );
+                    const size_t x1 = cell_of( std :: max( { a.x, b.x, c.x } ), _l_box.min.x, cell_x );
+                    const size_t y0 = cell_of( std :: min( { a.y, b.y, c.y } ), _l_box.min.y, cell_y );
+                    const size_t y1 = cell_of( std :: max( { a.y, b.y, c.y } ), _l_box.min.y, cell_y );
+
+                    for( size_t cy = y0; cy <= y1; ++cy )
+                        for( size_t cx = x0; cx <= x1; ++cx )
+                            for( uint32_t r : cells[ cy * side + cx ] ) {
+                                if( !reflex[ r ] || r == prev[ idx ] || r == next[ idx ] ) continue;
+
+                                const Vec2 p = vrtx[ r ];
+
+                                if( turn( a, b, p ) >= 0.0 && turn( b, c, p ) >= 0.0 && turn( c, a, p ) >= 0.0 )
+                                    return false;
+                            }
+
+                    return true;
+                };
+
+                _tris.reserve( 3 * ( n - 2 ) );
+                _tri_areas.reserve( n - 2 );
+
+                auto emit = [ & ] ( uint32_t a, uint32_t b, uint32_t c ) -> void {
+                    _tris.push_back( a );
+                    _tris.push_back( b );
+                    _tris.push_back( c );
+
+                    _tri_areas.push_back( 
+                        ( _tri_areas.empty() ? T( 0 ) : _tri_areas.back() ) + _tri_area( vrtx[ a ], vrtx[ b ], vrtx[ c ] ) 
+                    );
+                };
+
+                uint32_t idx   = 0;
+                size_t   left  = n;
+                size_t   stall = 0;
+
+                while( left > 3 ) {
+                    /* A full lap without an ear means the outline is not simple, clip anyway to terminate. */
+                    if( !is_ear( idx ) && stall++ < left ) {
+                        idx = next[ idx ];
+                        continue;
+                    }
+
+                    const uint32_t p = prev[ idx ];
+                    const uint32_t q = next[ idx ];
+
+                    emit( p, idx, q );
+
+                    reflex[ idx ] = false;
+
+                    next[ p ] = q;
+                    prev[ q ] = p;
+
+                    --left;
+                    stall = 0;
+
+                    classify( p );
+                    classify( q );
+
+                    /* Skipping past the neighbour halves the outline per lap instead of fanning from one vertex. */
+                    idx = next[ q ];
+                }
+
+                emit( prev[ idx ], idx, next[ idx ] );
+            }
+
+            /* Drops triangulation diagonals while both ends stay convex, at most four times the optimal part count. */
+            void _decompose() const {
+                const auto   tris = triangles();
+                const Lanes& vrtx = _vrtx;
+
+                _parts.clear();
+                _parts_dirty = false;
+
+                if( tris.empty() ) return;
+
+                T winding = 0.0;
+
+                for( size_t idx = 0; idx < vrtx_count(); ++idx ) {
+                    const Vec2 a = vrtx[ idx ];
+                    const Vec2 b = vrtx[ ( idx + 1 ) % vrtx_count() ];
+
+                    winding += a.x * b.y - a.y * b.x;
+                }
+
+                const T orient = winding < 0.0 ? T( -1 ) : T( 1 );
+
+                auto convex = [ & ] ( uint32_t a, uint32_t b, uint32_t c ) -> bool {
+                    const Vec2 p = vrtx[ a ];
+                    const Vec2 q = vrtx[ b ];
+                    const Vec2 r = vrtx[ c ];
+
+                    return orient * ( ( q.x - p.x ) * ( r.y - q.y ) - ( q.y - p.y ) * ( r.x - q.x ) ) >= 0.0;
+                };
+
+                auto key = [] ( uint32_t u, uint32_t v ) -> uint64_t {
+                    return uint64_t( u ) << 32 | v;
+                };
+
+                std :: vector< std :: vector< uint32_t > >     polys( tris.size() / 3 );
+                std :: unordered_map< uint64_t, uint32_t >     owner{};
+                std :: vector< std :: pair< uint32_t, uint32_t > > diagonals{};
+
+                owner.reserve( tris.size() );
+
+                for( uint32_t tri = 0; tri < polys.size(); ++tri ) {
+                    polys[ tri ] = { tris[ 3 * tri ], tris[ 3 * tri + 1 ], tris[ 3 * tri + 2 ] };
+
+                    for( size_t k = 0; k < 3; ++k ) {
+                        const uint32_t u = polys[ tri ][ k ];
+                        const uint32_t v = polys[ tri ][ ( k + 1 ) % 3 ];
+
+                        owner[ key( u, v ) ] = tri;
+
+                        if( owner.contains( key( v, u ) ) ) diagonals.emplace_back( u, v );
+                    }
+                }
+
+                for( auto [ u, v ] : diagonals ) {
+                    const uint32_t p_id = owner[ key( u, v ) ];
+                    const uint32_t q_id = owner[ key( v, u ) ];
+
+                    const std :: vector< uint32_t >& p = polys[ p_id ];
+                    const std :: vector< uint32_t >& q = polys[ q_id ];
+
+                    const size_t n  = p.size();
+                    const size_t m  = q.size();
+                    const size_t iu = std :: find( p.begin(), p.end(), u ) - p.begin();
+                    const size_t jv = std :: find( q.begin(), q.end(), v ) - q.begin();
+
+                    if( !convex( p[ ( iu + n - 1 ) % n ], u, q[ ( jv + 2 ) % m ] ) ) continue;
+                    if( !convex( q[ ( jv + m - 1 ) % m ], v, p[ ( iu + 2 ) % n ] ) ) continue;
+
+                    /* p runs v .. u, q then carries on from u back round to v. */
+                    std :: vector< uint32_t > merged{};
+
+                    merged.reserve( n + m - 2 );
+
+                    for( size_t k = 1; k <= n; ++k )     merged.push_back( p[ ( iu + k ) % n ] );
+                    for( size_t k = 2; k < m; ++k )      merged.push_back( q[ ( jv + k ) % m ] );
+
+                    for( size_t k = 0; k < m; ++k )
+                        owner[ key( q[ k ], q[ ( k + 1 ) % m ] ) ] = p_id;
+
+                    owner.erase( key( u, v ) );
+                    owner.erase( key( v, u ) );
+
+                    polys[ p_id ] = std :: move( merged );
+                    polys[ q_id ].clear();
+                }
+
+                for( const auto& poly : polys ) {
+                    if( poly.empty() ) continue;
+
+                    std :: vector< Vec2 > b_vrtx{};
+
+                    b_vrtx.reserve( poly.size() );
+
+                    for( uint32_t idx : poly )
+                        b_vrtx.push_back( std :: as_const( _b_vrtx )[ idx ] );
+
+                    Clust2& part = _parts.emplace_back( _derive( std :: move( b_vrtx ) ) );
+
+                    part._convex      = true;
+                    part._shape_dirty = false;
+                }
+            }
+
+            bool _uses_parts() const {
+                return _decomposed && !is_convex();
+            }
+
+            static T _tri_area( const Vec2& a, const Vec2& b, const Vec2& c ) {
+                return Scalar< T > :: abs( ( b.x - a.x ) * ( c.y - a.y ) - ( b.y - a.y ) * ( c.x - a.x ) ) / T( 2 );
+            }
+
+        private:
+            std :: vector< Vec2 > _base() const {
+                std :: vector< Vec2 > vrtx{};
+                vrtx.reserve( vrtx_count() );
+
+                for( size_t idx = 0; idx < vrtx_count(); ++idx )
+                    vrtx.push_back( std :: as_const( _b_vrtx )[ idx ] );
+
+                return vrtx;
+            }
+
+            Clust2 _derive( std :: vector< Vec2 > b_vrtx ) const {
+                Clust2 clust{ origin(), b_vrtx };
+
+                clust._angel  = _angel;
+                clust._scaleX = _scaleX;
+                clust._scaleY = _scaleY;
+
+                clust._refresh();
+
+                return clust;
+            }
+
+            static T _seg_dist_sq( const Vec2& vec, const Vec2& a, const Vec2& b ) {
+                const Vec2 ab = b - a;
+                const T    len_sq = ab.mag_sq();
+
+                if( len_sq == 0.0 ) return vec.dist_sq_to( a );
+
+                const T t = std :: clamp( ( vec - a ).dot( ab ) / len_sq, T( 0 ), T( 1 ) );
+
+                return vec.dist_sq_to( a + ab * t );
+            }
+
+        public:
+            template< typename R >
+            auto X( const Vec2& vec ) const {
+                return this -> X< R >( Ray2{ Vec2 :: O(), vec } );
+            }
+
+            template< typename R >
+            auto X( const Ray2& ray ) const {
+                if constexpr( std :: is_same_v< bool, R > )
+                    return _intersect_ray_bool( ray );
+                else if constexpr( std :: is_same_v< Vec2, R > )
+                    return _intersect_ray_vec( ray );
+                else {
+                    R Xs{};
+
+                    _each_ray_X( ray, [ &Xs ] ( const Vec2& vec ) -> bool { Xs.push_back( vec ); return true; } );
+
+                    return Xs;
+                }
+            }
+
+            template< typename R >
+            auto X( const Clust2& other ) const { 
+                if constexpr( std :: is_same_v< bool, R > )
+                    return _intersect_bool( other ); 
+                else if constexpr( std :: is_same_v< Contact2, R > )
+                    return _intersect_contact( other );
+                else if constexpr( std :: is_same_v< Vec2, R > )
+                    return _intersect_vec( other );
+                else {
+                    R Xs{};
+
+                    _each_X( other, [ &Xs ] ( const Vec2& vec ) -> bool { Xs.push_back( vec ); return true; } );
+
+                    return Xs;
+                }
+            }
+
+            Proximity2 proximity( const Clust2& other ) const;
+
+            std :: optional< Impact2 > sweep( const Motion2& motion, const Clust2& other, const Motion2& other_motion = {} ) const;
+
+        public:
+            /* World-space outlines, spin and scale baked in. Pieces come back anchored at this origin. */
+            std :: vector< Region2 > clip( const Clust2& other, Boolean op ) const;
+
+            std :: vector< Region2 > unite( const Clust2& other ) const {
+                return clip( other, UNITE );
+            }
+
+            std :: vector< Region2 > intersect( const Clust2& other ) const {
+                return clip( other, INTERSECT );
+            }
+
+            std :: vector< Region2 > subtract( const Clust2& other ) const {
+                return clip( other, SUBTRACT );
+            }
+
+        public:
+            template< typename R, typename Out >
+            requires ( std :: is_same_v< Vec2, R > && std :: output_iterator< Out, Vec2 > )
+            Out X( const Ray2& ray, Out out ) const {
+                _each_ray_X( ray, [ &out ] ( const Vec2& vec ) -> bool { *out++ = vec; return true; } );
+
+                return out;
+            }
+
+            template< typename R, typename Out >
+            requires ( std :: is_same_v< Vec2, R > && std :: output_iterator< Out, Vec2 > )
+            Out X( const Clust2& other, Out out ) const {
+                _each_X( other, [ &out ] ( const Vec2& vec ) -> bool { *out++ = vec; return true; } );
+
+                return out;
+            }
+
+            template< typename R >
+            requires std :: is_same_v< Vec2, R >
+            size_t X( const Ray2& ray, std :: span< Vec2 > out ) const {
+                size_t count = 0;
+
+                if( !out.empty() )
+                    _each_ray_X( ray, [ &out, &count ] ( const Vec2& vec ) -> bool { out[ count++ ] = vec; return count < out.size(); } );
+
+                return count;
+            }
+
+            template< typename R >
+            requires std :: is_same_v< Vec2, R >
+            size_t X( const Clust2& other, std :: span< Vec2 > out ) const {
+                size_t count = 0;
+
+                if( !out.empty() )
+                    _each_X( other, [ &out, &count ] ( const Vec2& vec ) -> bool { out[ count++ ] = vec; return count < out.size(); } );
+
+                return count;
+            }
+
+            std :: optional< Vec2 > first_hit( const Ray2& ray ) const {
+                std :: optional< Vec2 > hit{};
+
+                _each_ray_X( ray, [ &hit ] ( const Vec2& vec ) -> bool { hit = vec; return false; } );
+
+                return hit;
+            }
+
+            std :: optional< Vec2 > first_hit( const Clust2& other ) const {
+                std :: optional< Vec2 > hit{};
+
+                _each_X( other, [ &hit ] ( const Vec2& vec ) -> bool { hit = vec; return false; } );
+
+                return hit;
+            }
+
+        private:
+            template< typename F >
+            bool _each_ray_X( const Ray2& ray, F&& func ) const {
+                _sync();
+
+                if( !_w_box.strike( ray ).has_value() ) return true;
+
+                for( size_t idx = 0; idx < vrtx_count(); ++idx ) {
+                    auto vec = _mkray( idx ).template X< Vec2 >( ray );
+
+                    if( vec.has_value() && !func( vec.value() ) ) 
+                        return false;
+                }
+
+                return true;
+            }
+
+            template< typename F >
+            bool _each_X( const Clust2& other, F&& func ) const {
+                if( !box().overlaps( other.box() ) ) return true;
+
+                for( size_t idx = 0; idx < other.vrtx_count(); ++idx )
+                    if( !_each_ray_X( other._mkray( idx ), func ) ) 
+                        return false;
+
+                return true;
+            }
+
+        private:
+            bool _intersect_ray_bool( const Ray2& ray ) const {
+                _sync();
+
+                if( !_w_box.strike( ray ).has_value() ) return false;
+
+                for( size_t idx = 0; idx < vrtx_count(); ++idx )
+                    if( _mkray( idx ).template X< bool >( ray ) )
+                        return true;
+
+                return false;
+            }
+
+            std :: vector< Vec2 > _intersect_ray_vec( const Ray2& ray ) const {
+                std :: vector< Vec2 > Xs{};
+
+                X< Vec2 >( ray, std :: back_inserter( Xs ) );
+
+                return Xs;
+            }
+
+            bool _intersect_bool( const Clust2& other ) const {
+                if( !box().overlaps( other.box() ) ) return false;
+
+                if( is_convex() && other.is_convex() )
+                    return sat( other ).has_value();
+
+                if( _uses_parts() || other._uses_parts() ) {
+                    const auto parts_a = _uses_parts() ? parts() : std :: span< const Clust2 >( this, 1 );
+                    const auto parts_b = other._uses_parts() ? other.parts() : std :: span< const Clust2 >( &other, 1 );
+
+                    for( const Clust2& a : parts_a ) {
+                        if( !a.box().overlaps( other.box() ) ) continue;
+
+                        for( const Clust2& b : parts_b )
+                            if( a.box().overlaps( b.box() ) && a._intersect_bool( b ) ) return true;
+                    }
+
+                    return false;
+                }
+
+                for( size_t idx = 0; idx < other.vrtx_count(); ++idx )
+                    if( this -> X< bool >( other._mkray( idx ) ) )
+                        return true;
+
+                if( vrtx_count() == 0 || other.vrtx_count() == 0 ) return false;
+
+                return contains( other( 0 ) ) || other.contains( ( *this )( 0 ) );
+            }
+
+            std :: optional< Contact2 > _intersect_contact( const Clust2& other ) const;
+
+            std :: vector< Vec2 > _intersect_vec( const Clust2& other ) const {
+                std :: vector< Vec2 > Xs{};
+
+                X< Vec2 >( other, std :: back_inserter( Xs ) );
+
+                return Xs;
+            }
+        
+        public:
+            bool is_convex() const {
+                if( _shape_dirty ) {
+                    _convex      = _check_convex();
+                    _shape_dirty = false;
+                }
+
+                return _convex;
+            }
+
+            /* Separating axes over a convex pair, empty when apart and for concave or empty outlines. */
+            std :: optional< Vec2 > sat( const Clust2& other ) const {
+                const size_t n = vrtx_count();
+                const size_t m = other.vrtx_count();
+
+                if( n == 0 || m == 0 || !is_convex() || !other.is_convex() ) return {};
+
+                if( !box().overlaps( other.box() ) ) return {};
+
+                const size_t start_a = _lowest( false );
+                const size_t start_b = other._lowest( true );
+
+                const bool ccw_a = _winding() > 0.0;
+                const bool ccw_b = other._winding() > 0.0;
+
+                auto vrtx_a = [ & ] ( size_t k ) -> Vec2 {
+                    k %= n;
+                    return std :: as_const( _w_vrtx )[ ccw_a ? ( start_a + k ) % n : ( start_a + n - k ) % n ];
+                };
+
+                auto vrtx_b = [ & ] ( size_t k ) -> Vec2 {
+                    k %= m;
+                    return -std :: as_const( other._w_vrtx )[ ccw_b ? ( start_b + k ) % m : ( start_b + m - k ) % m ];
+                };
+
+
+                size_t i = 0;
+                size_t j = 0;
+
+                Vec2   last  = vrtx_a( 0 ) + vrtx_b( 0 );
+                Vec2   axis  = {};
+                T depth = Scalar< T > :: inf();
+
+                while( i < n || j < m ) {
+                    T turn = 0.0;
+
+                    if( i == n ) 
+                        turn = -1.0;
+                    else if( j == m ) 
+                        turn = 1.0;
+                    else {
+                        Vec2 edge_a = vrtx_a( i + 1 ) - vrtx_a( i );
+                        Vec2 edge_b = vrtx_b( j + 1 ) - vrtx_b( j );
+
+                        turn = edge_a.x * edge_b.y - edge_a.y * edge_b.x;
+                    }
+
+                    if( turn >= 0.0 && i < n ) ++i;
+                    if( turn <= 0.0 && j < m ) ++j;
+
+                    Vec2 next = vrtx_a( i ) + vrtx_b( j );
+                    Vec2 edge = next - std :: exchange( last, next );
+
+                    T      len = edge.mag();
+
+                    if( len == 0.0 ) continue;
+
+                    Vec2   normal = Vec2{ edge.y, -edge.x } / len;
+                    T      dist   = ( next - edge ).dot( normal );
+
+                    if( dist < 0.0 ) return {};
+
+                    if( dist < depth ) {
+                        depth = dist;
+                        axis  = normal;
+                    }
+                }
+
+                return -axis * depth;
+            }
+
+        private:
+            bool _check_convex() const {
+                const size_t n = vrtx_count();
+
+                if( n < 3 ) return false;
+
+                int turn_sign = 0;
+                int last_dx   = 0;
+                int first_dx  = 0;
+                int dx_flips  = 0;
+
+                for( size_t idx = 0; idx < n; ++idx ) {
+                    Vec2 a = _vrtx[ idx ];
+                    Vec2 b = _vrtx[ ( idx + 1 ) % n ];
+                    Vec2 c = _vrtx[ ( idx + 2 ) % n ];
+
+                    T turn = ( b.x - a.x ) * ( c.y - b.y ) - ( b.y - a.y ) * ( c.x - b.x );
+
+                    if( turn != 0.0 ) {
+                        int sign = turn > 0.0 ? 1 : -1;
+
+                        if( turn_sign == 0 ) 
+                            turn_sign = sign;
+                        else if( sign != turn_sign ) 
+                            return false;
+                    }
+
+                    int dx = ( b.x > a.x ) - ( b.x < a.x );
+
+                    if( dx == 0 ) continue;
+
+                    if( first_dx == 0 ) 
+                        first_dx = dx;
+                    else if( dx != last_dx ) 
+                        ++dx_flips;
+
+                    last_dx = dx;
+                }
+
+                if( last_dx != first_dx ) ++dx_flips;
+
+                return turn_sign != 0 && dx_flips <= 2;
+            }
+
+            T _winding() const {
+                const size_t n = vrtx_count();
+
+                for( size_t idx = 0; idx < n; ++idx ) {
+                    Vec2 a = _vrtx[ idx ];
+                    Vec2 b = _vrtx[ ( idx + 1 ) % n ];
+                    Vec2 c = _vrtx[ ( idx + 2 ) % n ];
+
+                    T turn = ( b.x - a.x ) * ( c.y - b.y ) - ( b.y - a.y ) * ( c.x - b.x );
+
+                    if( turn != 0.0 ) return turn;
+                }
+
+                return 0.0;
+            }
+
+            size_t _lowest( bool negated ) const {
+                size_t low = 0;
+
+                for( size_t idx = 1; idx < vrtx_count(); ++idx ) {
+                    Vec2 v = negated ? -_vrtx[ idx ] : _vrtx[ idx ];
+                    Vec2 l = negated ? -_vrtx[ low ] : _vrtx[ low ];
+
+                    if( v.y < l.y || ( v.y == l.y && v.x < l.x ) ) 
+                        low = idx;
+                }
+
+                return low;
+            }
+
+        public:
+            /* Half-open in y, so a strike level with a vertex counts its edges once. */
+            bool contains( const Vec2& vec ) const {
+                uint8_t inside = 0;
+
+                _sync_edges();
+                _contains_batch( &vec, &inside, 1 );
+
+                return inside;
+            }
+
+            void contains_batch( std :: span< const Vec2 > vecs, std :: span< uint8_t > out ) const {
+                _sync_edges();
+
+                _contains_batch( vecs.data(), out.data(), std :: min( vecs.size(), out.size() ) );
+            }
+
+            void contains_batch( std :: span< const Vec2 > vecs, std :: span< uint8_t > out, size_t thread_count ) const {
+                _sync_edges();
+
+                parallel_for( std :: min( vecs.size(), out.size() ), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    _contains_batch( vecs.data() + begin, out.data() + begin, end - begin );
+                } );
+            }
+
+        public:
+            Nearest2 signed_distance( const Vec2& vec ) const {
+                Nearest2 nearest{};
+
+                _sync_edges();
+                _nearest_batch( &vec, &nearest, 1 );
+
+                return nearest;
+            }
+
+            void signed_distance( std :: span< const Vec2 > vecs, std :: span< Nearest2 > out, size_t thread_count = 1 ) const {
+                _sync_edges();
+
+                parallel_for( std :: min( vecs.size(), out.size() ), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    for( size_t idx = begin; idx < end; idx += NEAREST_BLOCK )
+                        _nearest_batch( vecs.data() + idx, out.data() + idx, std :: min( NEAREST_BLOCK, end - idx ) );
+                } );
+            }
+
+        private:
+            inline static constexpr size_t   NEAREST_BLOCK   = 256;
+
+            void _nearest_batch( const Vec2* vecs, Nearest2* out, size_t count ) const {
+                static_assert( sizeof( Ray2 ) == 4 * sizeof( T ) && std :: is_standard_layout_v< Ray2 >, "Kernels read rays as four packed scalars." );
+                static_assert( sizeof( Vec2 ) == 2 * sizeof( T ) && std :: is_standard_layout_v< Vec2 >, "Kernels read points as two packed scalars." );
+
+                if( vrtx_count() == 0 ) {
+                    std :: fill_n( out, count, Nearest2{ Scalar< T > :: inf(), {}, 0 } );
+
+                    return;
+                }
+
+                T        d2[ NEAREST_BLOCK ];
+                T        u[ NEAREST_BLOCK ];
+                size_t   edge[ NEAREST_BLOCK ];
+                uint8_t  inside[ NEAREST_BLOCK ];
+
+                Simd :: nearest( 
+                    reinterpret_cast< const T* >( _w_edges.rays.data() ), vrtx_count(),
+                    reinterpret_cast< const T* >( vecs ), count,
+                    d2, edge, u
+                );
+
+                _contains_batch( vecs, inside, count );
+
+                for( size_t idx = 0; idx < count; ++idx ) {
+                    const Ray2& ray = _w_edges.rays[ edge[ idx ] ];
+                    const T     d   = Scalar< T > :: sqrt( d2[ idx ] );
+
+                    out[ idx ] = { inside[ idx ] ? -d : d, ray.origin + ray.vec * u[ idx ], edge[ idx ] };
+                }
+            }
+
+        private:
+            void _refresh() {
+                Simd :: spin_scale( 
+                    _b_vrtx.x.data(), _b_vrtx.y.data(), 
+                    _vrtx.x.data(), _vrtx.y.data(), 
+                    vrtx_count(), 
+                    _angel, _scaleX, _scaleY 
+                );
+
+                _local_dirty = true;
+
+                if( _proxy ) {
+                    _proxy -> _angel  = _angel;
+                    _proxy -> _scaleX = _scaleX;
+                    _proxy -> _scaleY = _scaleY;
+
+                    _proxy -> _refresh();
+                }
+
+                for( Clust2& part : _parts ) {
+                    if( _parts_dirty ) break;
+
+                    part._angel  = _angel;
+                    part._scaleX = _scaleX;
+                    part._scaleY = _scaleY;
+
+                    part._refresh();
+                }
+            }
+
+            void _sync() const {
+                const Vec2 org = origin();
+
+                if( _local_dirty ) {
+                    _l_box = vrtx_count() == 0 ? Box2{} : Box2{ _vrtx[ 0 ], _vrtx[ 0 ] };
+
+                    for( size_t idx = 1; idx < vrtx_count(); ++idx ) {
+                        _l_box.min.x = std :: min( _l_box.min.x, _vrtx.x[ idx ] );
+                        _l_box.min.y = std :: min( _l_box.min.y, _vrtx.y[ idx ] );
+                        _l_box.max.x = std :: max( _l_box.max.x, _vrtx.x[ idx ] );
+                        _l_box.max.y = std :: max( _l_box.max.y, _vrtx.y[ idx ] );
+                    }
+
+                    _local_dirty = false;
+                    _world_dirty = true;
+                }
+
+                if( !_world_dirty && org == _w_origin ) return;
+
+                _w_vrtx.x.resize( vrtx_count() );
+                _w_vrtx.y.resize( vrtx_count() );
+
+                for( size_t idx = 0; idx < vrtx_count(); ++idx ) {
+                    _w_vrtx.x[ idx ] = _vrtx.x[ idx ] + org.x;
+                    _w_vrtx.y[ idx ] = _vrtx.y[ idx ] + org.y;
+                }
+
+                _w_box       = { _l_box.min + org, _l_box.max + org };
+                _w_origin    = org;
+                _world_dirty = false;
+                _edges_dirty = true;
+            }
+
+            void _sync_edges() const {
+                _sync();
+
+                if( !_edges_dirty ) return;
+
+                const size_t n = vrtx_count();
+
+                _w_edges.ax.resize( n );
+                _w_edges.ay.resize( n );
+                _w_edges.by.resize( n );
+                _w_edges.slope.resize( n );
+                _w_edges.rays.resize( n );
+
+                for( size_t idx = 0; idx < n; ++idx ) {
+                    size_t next = ( idx + 1 ) % n;
+
+                    T dy = _w_vrtx.y[ next ] - _w_vrtx.y[ idx ];
+
+                    _w_edges.ax[ idx ]    = _w_vrtx.x[ idx ];
+                    _w_edges.ay[ idx ]    = _w_vrtx.y[ idx ];
+                    _w_edges.by[ idx ]    = _w_vrtx.y[ next ];
+                    _w_edges.slope[ idx ] = dy == 0.0 ? T( 0 ) : ( _w_vrtx.x[ next ] - _w_vrtx.x[ idx ] ) / dy;
+                    _w_edges.rays[ idx ]  = _mkray( idx );
+                }
+
+                _edges_dirty = false;
+            }
+
+            void _contains_batch( const Vec2* vecs, uint8_t* out, size_t count ) const {
+                static_assert( sizeof( Vec2 ) == 2 * sizeof( T ) && std :: is_standard_layout_v< Vec2 >, "Kernels read points as two packed scalars." );
+
+                const T box[ 4 ] = { _w_box.min.x, _w_box.min.y, _w_box.max.x, _w_box.max.y };
+
+                Simd :: crossings( 
+                    _w_edges.ax.data(), _w_edges.ay.data(), _w_edges.by.data(), _w_edges.slope.data(),
+                    vrtx_count(),
+                    box,
+                    reinterpret_cast< const T* >( vecs ), out,
+                    count
+                );
+            }
+
+            Ray2 _mkray( size_t idx ) const {
+                return _mkray( idx, ( idx + 1 ) % vrtx_count() );
+            }
+
+            Ray2 _mkray( size_t idx1, size_t idx2 ) const {
+                const Lanes& w_vrtx = _w_vrtx;
+
+                return { w_vrtx[ idx1 ], w_vrtx[ idx2 ] - w_vrtx[ idx1 ] };
+            }
+        
+        public:
+            /* A positive proxy tolerance also builds a convex collision proxy from the loaded outline. */
+            static Clust2 from_file( std :: string_view path, T proxy_tolerance = 0.0 ) { 
+                std :: ifstream file( path.data() );
+
+                if( !file ) return {};
+
+                Vec2_t< double > org = {};
+
+                std :: vector< Vec2 > vrtx = {};
+
+                {
+                    bool has_origin = false;
+
+                    file >> has_origin;
+
+                    if( has_origin )
+                        file >> org.x >> org.y;
+                }
+
+                for( Vec2_t< double > vec; file >> vec.x >> vec.y; )
+                    vrtx.emplace_back( vec );
+
+                Clust2 clust{ Vec2( org ), vrtx };
+
+                if( proxy_tolerance > 0.0 ) clust.proxy_with( proxy_tolerance );
+
+                return clust;
+            }
+
+        public:
+            /*
+                Pack layout, little endian, every block 8 byte aligned:
+                    header    "GCL2" | u16 version | u16 reserved | u32 count | u32 reserved
+                    offsets   u64[ count ], from the start of the pack
+                    record    u32 vrtx_count | u16 flags | u16 reserved | [ origin x, y ] | x[ n ] | y[ n ]
+                Flags: PACK_ORIGIN when the origin is stored, PACK_WIDE for double scalars, float otherwise.
+            */
+            inline static constexpr char       PACK_MAGIC[ 4 ]   = { 'G', 'C', 'L', '2' };
+            inline static constexpr uint16_t   PACK_VERSION      = 1;
+            inline static constexpr uint16_t   PACK_ORIGIN       = 1;
+            inline static constexpr uint16_t   PACK_WIDE         = 2;
+
+            static std :: vector< Clust2 > from_pack( std :: string_view path ) {
+                Mapped_file file{ path };
+
+                if( !file ) return {};
+
+                return from_bytes( file.bytes() );
+            }
+
+            static std :: vector< Clust2 > from_bytes( std :: span< const char > bytes ) {
+                if( bytes.size() < 16 || std :: memcmp( bytes.data(), PACK_MAGIC, 4 ) != 0 ) return {};
+
+                const uint16_t version = _read< uint16_t >( bytes.data() + 4 );
+                const uint32_t count   = _read< uint32_t >( bytes.data() + 8 );
+
+                if( version > PACK_VERSION || 16 + size_t( count ) * 8 > bytes.size() ) return {};
+
+                std :: vector< Clust2 > clusts{};
+                clusts.reserve( count );
+
+                for( size_t idx = 0; idx < count; ++idx ) {
+                    const uint64_t offs = _read< uint64_t >( bytes.data() + 16 + idx * 8 );
+
+                    /* Subtracting keeps a corrupt offset from wrapping past the checks. */
+                    if( offs > bytes.size() || bytes.size() - offs < 8 ) break;
+
+                    const char*    rec   = bytes.data() + offs;
+                    const uint32_t n     = _read< uint32_t >( rec );
+                    const uint16_t flags = _read< uint16_t >( rec + 4 );
+                    const size_t   width = ( flags & PACK_WIDE ) ? sizeof( double ) : sizeof( float );
+                    const size_t   lead  = ( flags & PACK_ORIGIN ) ? 2 : 0;
+
+                    if( ( bytes.size() - offs - 8 ) / width < lead + 2 * size_t( n ) ) break;
+
+                    Clust2& clust = clusts.emplace_back();
+
+                    if( flags & PACK_WIDE ) clust._unpack< double >( rec + 8, n, lead );
+                    else                    clust._unpack< float >( rec + 8, n, lead );
+                }
+
+                return clusts;
+            }
+
+            /* Base vertices and world origins are stored, spin and scale are not. */
+            static bool to_pack( std :: string_view path, std :: span< const Clust2 > clusts, bool wide = false ) {
+                std :: ofstream file( path.data(), std :: ios_base :: binary );
+
+                if( !file ) return false;
+
+                const size_t width = wide ? sizeof( double ) : sizeof( float );
+
+                std :: vector< uint64_t > offsets( clusts.size() );
+                uint64_t                  offs = 16 + clusts.size() * 8;
+
+                for( size_t idx = 0; idx < clusts.size(); ++idx ) {
+                    offsets[ idx ] = offs;
+
+                    const size_t lead = clusts[ idx ].origin() == Vec2 :: O() ? 0 : 2;
+
+                    offs += ( 8 + ( lead + 2 * clusts[ idx ].vrtx_count() ) * width + 7 ) & ~uint64_t( 7 );
+                }
+
+                const uint16_t version = PACK_VERSION;
+                const uint32_t count   = static_cast< uint32_t >( clusts.size() );
+                const uint32_t zero    = 0;
+
+                file.write( PACK_MAGIC, 4 );
+                file.write( reinterpret_cast< const char* >( &version ), 2 );
+                file.write( reinterpret_cast< const char* >( &zero ), 2 );
+                file.write( reinterpret_cast< const char* >( &count ), 4 );
+                file.write( reinterpret_cast< const char* >( &zero ), 4 );
+                file.write( reinterpret_cast< const char* >( offsets.data() ), offsets.size() * 8 );
+
+                for( const Clust2& clust : clusts ) {
+                    if( wide ) clust._pack< double >( file );
+                    else       clust._pack< float >( file );
+                }
+
+                return static_cast< bool >( file );
+            }
+
+            static bool text_to_pack( std :: span< const std :: string > text_paths, std :: string_view path, bool wide = false ) {
+                std :: vector< Clust2 > clusts{};
+                clusts.reserve( text_paths.size() );
+
+                for( const std :: string& text_path : text_paths )
+                    clusts.push_back( from_file( text_path ) );
+
+                return to_pack( path, clusts, wide );
+            }
+
+        private:
+            template< typename S >
+            static S _read( const char* src ) {
+                S value;
+
+                std :: memcpy( &value, src, sizeof( S ) );
+
+                return value;
+            }
+
+            template< typename S >
+            void _unpack( const char* src, size_t n, size_t lead ) {
+                if( lead != 0 )
+                    _origin = Vec2{ static_cast< T >( _read< S >( src ) ), static_cast< T >( _read< S >( src + sizeof( S ) ) ) };
+
+                src += lead * sizeof( S );
+
+                for( std :: vector< T >* lane : { &_b_vrtx.x, &_b_vrtx.y } ) {
+                    lane -> resize( n );
+
+                    if constexpr( std :: is_same_v< S, T > ) 
+                        std :: memcpy( lane -> data(), src, n * sizeof( S ) );
+                    else 
+                        for( size_t idx = 0; idx < n; ++idx )
+                            ( *lane )[ idx ] = static_cast< T >( _read< S >( src + idx * sizeof( S ) ) );
+
+                    src += n * sizeof( S );
+                }
+
+                _vrtx = _b_vrtx;
+            }
+
+            template< typename S >
+            void _pack( std :: ofstream& file ) const {
+                const Vec2     org   = origin();
+                const uint32_t n     = static_cast< uint32_t >( vrtx_count() );
+                const uint16_t flags = ( org == Vec2 :: O() ? 0 : PACK_ORIGIN ) | ( std :: is_same_v< S, double > ? PACK_WIDE : 0 );
+                const uint16_t zero  = 0;
+
+                file.write( reinterpret_cast< const char* >( &n ), 4 );
+                file.write( reinterpret_cast< const char* >( &flags ), 2 );
+                file.write( reinterpret_cast< const char* >( &zero ), 2 );
+
+                std :: vector< S > scalars{};
+                scalars.reserve( 2 + 2 * n );
+
+                if( flags & PACK_ORIGIN ) {
+                    scalars.push_back( static_cast< S >( org.x ) );
+                    scalars.push_back( static_cast< S >( org.y ) );
+                }
+
+                for( const std :: vector< T >* lane : { &_b_vrtx.x, &_b_vrtx.y } )
+                    for( const T& value : *lane )
+                        scalars.push_back( static_cast< S >( value ) );
+
+                while( ( scalars.size() * sizeof( S ) ) % 8 != 0 ) scalars.push_back( S( 0 ) );
+
+                file.write( reinterpret_cast< const char* >( scalars.data() ), scalars.size() * sizeof( S ) );
+            }
+    
+        public:
+            void render( Ref< Renderer > renderer, Ref< Is_brush auto > brush ) const;
+
+            void render( Ref< Renderer > renderer, Ref< Is_brush auto > brush, Paint paint ) const;
+
+        };
+
+
+
+        template< typename T >
+        template< typename R >
+        auto Vec2_t< T > :: X( const Ray2& ray ) const {
+            return ray.template X< R >( *this );
+        }
+
+        template< typename T >
+        template< typename R >
+        auto Vec2_t< T > :: X( const Clust2& clust ) const {
+            return clust.template X< R >( *this );
+        }
+
+
+        template< typename T >
+        template< typename R >
+        auto Ray2_t< T > :: X( const Clust2& clust ) const {
+            return clust.template X< R >( *this );
+        }
+
+
+        template< typename T >
+        void Ray2_t< T > :: cast( std :: span< const Ray2 > rays, std :: span< const Clust2* const > obstacles, std :: span< Hit2 > hits ) {
+            static_assert( sizeof( Ray2 ) == 4 * sizeof( T ) && std :: is_standard_layout_v< Ray2 >, "Kernels read rays as four packed scalars." );
+
+            const size_t count = std :: min( rays.size(), hits.size() );
+
+            for( const Clust2* clust : obstacles )
+                clust -> _sync_edges();
+
+            for( size_t begin = 0; begin < count; begin += PACKET ) {
+                const size_t n = std :: min( PACKET, count - begin );
+
+                T t[ PACKET ];
+                size_t edge[ PACKET ];
+                size_t tag[ PACKET ];
+
+                std :: fill_n( t, n, 1.0 );
+                std :: fill_n( edge, n, Hit2 :: NONE );
+
+                for( size_t obs = 0; obs < obstacles.size(); ++obs ) {
+                    const Box2& box = obstacles[ obs ] -> _w_box;
+
+                    if( std :: none_of( rays.data() + begin, rays.data() + begin + n, [ &box ] ( const Ray2& ray ) -> bool { 
+                        return box.strike( ray ).has_value(); 
+                    } ) ) continue;
+
+                    Simd :: strike( 
+                        reinterpret_cast< const T* >( obstacles[ obs ] -> _w_edges.rays.data() ), obstacles[ obs ] -> vrtx_count(),
+                        reinterpret_cast< const T* >( rays.data() + begin ), n,
+                        t, edge, tag, obs
+                    );
+                }
+
+                _emit( rays.data() + begin, hits.data() + begin, n, t, edge, [ & ] ( size_t idx ) -> const Clust2* { 
+                    return obstacles[ tag[ idx ] ]; 
+                } );
+            }
+        }
+
+
+
+        /*
+            Polygon overlay on world rings. Both rings are split at every crossing, each piece is kept
+            or dropped by which side of the other ring it lies on, and the kept pieces are walked back
+            into loops. Counter-clockwise loops are outlines, clockwise ones are holes.
+        */
+        template< typename T >
+        class Clip2_t {
+        public:
+            typedef   Vec2_t< T >      Vec2;
+            typedef   Box2_t< T >      Box2;
+            typedef   Clust2_t< T >    Clust2;
+            typedef   Region2_t< T >   Region2;
+
+            typedef   std :: vector< Vec2 >   Ring;
+
+        private:
+            struct Cut {
+                size_t   edge   = 0;
+                T        t      = 0.0;
+                Vec2     at     = {};
+            };
+
+            /* Junctions start on both rings, the only places a walk may branch. */
+            struct Edge {
+                Vec2     from       = {};
+                Vec2     to         = {};
+                bool     junction   = false;
+            };
+
+        public:
+            static std :: vector< Region2 > apply( const Clust2& c1, const Clust2& c2, Boolean op ) {
+                const Ring a   = ring( c1 );
+                const Ring b   = ring( c2 );
+                const Vec2 org = c1.origin();
+
+                std :: vector< Region2 > regions = {};
+
+                if( a.size() < 3 || b.size() < 3 || !_bounds( a ).overlaps( _bounds( b ) ) ) {
+                    if( op != INTERSECT && a.size() >= 3 ) regions.push_back( { _make( org, a ) } );
+                    if( op == UNITE && b.size() >= 3 )     regions.push_back( { _make( org, b ) } );
+
+                    return regions;
+                }
+
+                if( op == INTERSECT && c1.is_convex() && c2.is_convex() ) {
+                    Ring piece = sutherland_hodgman( a, b );
+
+                    if( piece.size() >= 3 ) regions.push_back( { _make( org, piece ) } );
+
+                    return regions;
+                }
+
+                return _assemble( _link( _select( a, b, op ) ), org );
+            }
+
+        public:
+            /* Counter-clockwise world vertices, repeats dropped. */
+            static Ring ring( const Clust2& clust ) {
+                Ring vrtx = {};
+
+                vrtx.reserve( clust.vrtx_count() );
+
+                for( size_t idx = 0; idx < clust.vrtx_count(); ++idx )
+                    vrtx.push_back( clust( idx ) );
+
+                _dedup( vrtx );
+
+                if( _area2( vrtx ) < 0.0 ) std :: reverse( vrtx.begin(), vrtx.end() );
+
+                return vrtx;
+            }
+
+            /* Clip must be convex and counter-clockwise. A concave subject comes back as one ring bridged along the clip edges. */
+            static Ring sutherland_hodgman( const Ring& subject, const Ring& clip ) {
+                Ring out = subject;
+                Ring in  = {};
+
+                for( size_t j = 0; j < clip.size() && !out.empty(); ++j ) {
+                    const Vec2& c0   = clip[ j ];
+                    const Vec2  edge = clip[ ( j + 1 ) % clip.size() ] - c0;
+
+                    in.swap( out );
+                    out.clear();
+
+                    for( size_t idx = 0; idx < in.size(); ++idx ) {
+                        const Vec2& prev = in[ ( idx + in.size() - 1 ) % in.size() ];
+                        const Vec2& cur  = in[ idx ];
+
+                        T dp = _cross( edge, prev - c0 );
+                        T dc = _cross( edge, cur - c0 );
+
+                        if( dc >= 0.0 ) {
+                            if( dp < 0.0 ) out.push_back( prev + ( cur - prev ) * ( dp / ( dp - dc ) ) );
+
+                            out.push_back( cur );
+                        }
+                        else if( dp > 0.0 )
+                            out.push_back( prev + ( cur - prev ) * ( dp / ( dp - dc ) ) );
+                    }
+                }
+
+                _dedup( out );
+
+                return out;
+            }
+
+        private:
+            static std :: vector< Edge > _select( const Ring& a, const Ring& b, Boolean op ) {
+                const Box2 box_a = _bounds( a );
+                const Box2 box_b = _bounds( b );
+
+                std :: vector< Cut > cuts_a = {};
+                std :: vector< Cut > cuts_b = {};
+
+                for( size_t i = 0; i < a.size(); ++i ) {
+                    const Vec2& p  = a[ i ];
+                    const Vec2& p2 = a[ ( i + 1 ) % a.size() ];
+                    const Box2  ea = _edge_box( p, p2 );
+
+                    if( !ea.overlaps( box_b ) ) continue;
+
+                    for( size_t j = 0; j < b.size(); ++j ) {
+                        const Vec2& q  = b[ j ];
+                        const Vec2& q2 = b[ ( j + 1 ) % b.size() ];
+
+                        if( ea.overlaps( _edge_box( q, q2 ) ) )
+                            _cross_cut( i, p, p2, j, q, q2, cuts_a, cuts_b );
+                    }
+                }
+
+                std :: vector< Edge > pieces_a = _split( a, cuts_a );
+                std :: vector< Edge > pieces_b = _split( b, cuts_b );
+
+                /* Only pieces inside both boxes can lie on the other ring. */
+                std :: vector< Edge > keys_a = _keys( pieces_a, box_b );
+                std :: vector< Edge > keys_b = _keys( pieces_b, box_a );
+
+                std :: vector< Edge > kept   = {};
+                std :: vector< Edge > kept_b = {};
+
+                kept.reserve( pieces_a.size() + pieces_b.size() );
+
+                _keep( pieces_a, keys_b, b, box_b, op == INTERSECT, op != SUBTRACT, op == SUBTRACT, kept );
+                _keep( pieces_b, keys_a, a, box_a, op != UNITE, false, false, kept_b );
+
+                if( op == SUBTRACT ) {
+                    std :: reverse( kept_b.begin(), kept_b.end() );
+
+                    for( Edge& edge : kept_b )
+                        edge = { edge.to, edge.from, box_a.contains( edge.to ) && _touches( keys_a, edge.to ) };
+                }
+
+                kept.insert( kept.end(), kept_b.begin(), kept_b.end() );
+
+                return kept;
+            }
+
+            /*
+                A piece takes the side of the one before it unless it starts on the other ring,
+                so the crossings test only runs once per stretch between cuts.
+            */
+            static void _keep(
+                const std :: vector< Edge >& pieces, const std :: vector< Edge >& keys, const Ring& other, const Box2& box,
+                bool inside, bool along, bool against, std :: vector< Edge >& kept
+            ) {
+                bool side  = false;
+                bool known = false;
+
+                for( const Edge& edge : pieces ) {
+                    if( !_edge_box( edge.from, edge.to ).overlaps( box ) ) {
+                        if( !inside ) kept.push_back( edge );
+
+                        side  = false;
+                        known = true;
+                        continue;
+                    }
+
+                    bool junction = _touches( keys, edge.from );
+
+                    switch( _shared( keys, edge ) ) {
+                        case  1: if( along )   kept.push_back( { edge.from, edge.to, true } ); continue;
+                        case -1: if( against ) kept.push_back( { edge.from, edge.to, true } ); continue;
+                    }
+
+                    if( !known || junction ) {
+                        Vec2 mid = ( edge.from + edge.to ) / 2.0;
+
+                        side  = box.contains( mid ) && _inside( other, mid );
+                        known = true;
+                    }
+
+                    if( side == inside ) kept.push_back( { edge.from, edge.to, junction } );
+                }
+            }
+
+            static void _cross_cut(
+                size_t i, const Vec2& p, const Vec2& p2, size_t j, const Vec2& q, const Vec2& q2,
+                std :: vector< Cut >& cuts_a, std :: vector< Cut >& cuts_b
+            ) {
+                const Vec2 r  = p2 - p;
+                const Vec2 s  = q2 - q;
+                const Vec2 qp = q - p;
+
+                T denom = _cross( r, s );
+
+                if( denom != 0.0 ) {
+                    T t = _cross( qp, s ) / denom;
+                    T u = _cross( qp, r ) / denom;
+
+                    if( t < 0.0 || t > 1.0 || u < 0.0 || u > 1.0 ) return;
+
+                    /* Both sides take the same point, so the pieces meet bit-exact when linked. */
+                    Vec2 at = t == 0.0 ? p : t == 1.0 ? p2 : u == 0.0 ? q : u == 1.0 ? q2 : p + r * t;
+
+                    if( t > 0.0 && t < 1.0 ) cuts_a.push_back( { i, t, at } );
+                    if( u > 0.0 && u < 1.0 ) cuts_b.push_back( { j, u, at } );
+
+                    return;
+                }
+
+                if( _cross( qp, r ) != 0.0 ) return;
+
+                /* Collinear overlap, each edge splits at the other's ends. */
+                for( const Vec2& end : { q, q2 } ) {
+                    T t = ( end - p ).dot( r ) / r.dot( r );
+
+                    if( t > 0.0 && t < 1.0 ) cuts_a.push_back( { i, t, end } );
+                }
+
+                for( const Vec2& end : { p, p2 } ) {
+                    T u = ( end - q ).dot( s ) / s.dot( s );
+
+                    if( u > 0.0 && u < 1.0 ) cuts_b.push_back( { j, u, end } );
+                }
+            }
+
+            static std :: vector< Edge > _split( const Ring& ring, std :: vector< Cut >& cuts ) {
+                std :: vector< Edge > pieces = {};
+
+                pieces.reserve( ring.size() + cuts.size() );
+
+                std :: sort( cuts.begin(), cuts.end(), [] ( const Cut& l, const Cut& r ) -> bool {
+                    return l.edge < r.edge || ( l.edge == r.edge && l.t < r.t );
+                } );
+
+                auto cut = cuts.begin();
+
+                for( size_t idx = 0; idx < ring.size(); ++idx ) {
+                    Vec2 from = ring[ idx ];
+
+                    for( ; cut != cuts.end() && cut -> edge == idx; ++cut ) {
+                        if( cut -> at == from ) continue;
+
+                        pieces.push_back( { from, cut -> at } );
+                        from = cut -> at;
+                    }
+
+                    const Vec2& to = ring[ ( idx + 1 ) % ring.size() ];
+
+                    if( to != from ) pieces.push_back( { from, to } );
+                }
+
+                return pieces;
+            }
+
+            static std :: vector< Edge > _keys( const std :: vector< Edge >& pieces, const Box2& box ) {
+                std :: vector< Edge > keys = {};
+
+                for( const Edge& edge : pieces )
+                    if( _edge_box( edge.from, edge.to ).overlaps( box ) ) keys.push_back( edge );
+
+                std :: sort( keys.begin(), keys.end(), _edge_less );
+
+                return keys;
+            }
+
+            /* 1 when the piece runs along keys the same way, -1 when against, 0 when not there. */
+            static int _shared( const std :: vector< Edge >& keys, const Edge& edge ) {
+                if( std :: binary_search( keys.begin(), keys.end(), edge, _edge_less ) ) return 1;
+
+                if( std :: binary_search( keys.begin(), keys.end(), Edge{ edge.to, edge.from }, _edge_less ) ) return -1;
+
+                return 0;
+            }
+
+            static bool _touches( const std :: vector< Edge >& keys, const Vec2& vec ) {
+                auto itr = std :: lower_bound( keys.begin(), keys.end(), vec, [] ( const Edge& edge, const Vec2& vec ) -> bool {
+                    return _vec_less( edge.from, vec );
+                } );
+
+                return itr != keys.end() && itr -> from == vec;
+            }
+
+            /*
+                Kept pieces mostly arrive in ring order, so the walk steps straight on and only looks up
+                heads: junctions and pieces that do not follow their neighbour. At a junction it takes the
+                sharpest left turn, so loops touching at a point come out apart.
+            */
+            static std :: vector< Ring > _link( const std :: vector< Edge >& edges ) {
+                std :: vector< size_t > heads = {};
+                std :: vector< bool >   head( edges.size(), false );
+                std :: vector< bool >   used( edges.size(), false );
+
+                for( size_t idx = 0; idx < edges.size(); ++idx )
+                    if( edges[ idx ].junction || idx == 0 || edges[ idx - 1 ].to != edges[ idx ].from ) {
+                        head[ idx ] = true;
+                        heads.push_back( idx );
+                    }
+
+                std :: sort( heads.begin(), heads.end(), [ & ] ( size_t l, size_t r ) -> bool {
+                    return _vec_less( edges[ l ].from, edges[ r ].from );
+                } );
+
+                std :: vector< Ring > loops = {};
+
+                for( size_t start = 0; start < edges.size(); ++start ) {
+                    if( used[ start ] ) continue;
+
+                    Ring   loop = {};
+                    size_t cur  = start;
+
+                    for(;;) {
+                        used[ cur ] = true;
+                        loop.push_back( edges[ cur ].from );
+
+                        const Vec2& at = edges[ cur ].to;
+
+                        if( at == edges[ start ].from ) break;
+
+                        if( cur + 1 < edges.size() && !head[ cur + 1 ] && !used[ cur + 1 ] ) {
+                            ++cur;
+                            continue;
+                        }
+
+                        const Vec2 back = edges[ cur ].from - at;
+
+                        size_t next = edges.size();
+                        T      best = 0.0;
+
+                        auto itr = std :: lower_bound( heads.begin(), heads.end(), at, [ & ] ( size_t idx, const Vec2& vec ) -> bool {
+                            return _vec_less( edges[ idx ].from, vec );
+                        } );
+
+                        for( ; itr != heads.end() && edges[ *itr ].from == at; ++itr ) {
+                            if( used[ *itr ] ) continue;
+
+                            const Vec2 out  = edges[ *itr ].to - at;
+                            T          turn = -Scalar< T > :: atan2( _cross( back, out ), back.dot( out ) );
+
+                            if( turn <= 0.0 ) turn += T( 2.0 * PI );
+
+                            if( next == edges.size() || turn < best ) {
+                                next = *itr;
+                                best = turn;
+                            }
+                        }
+
+                        if( next == edges.size() ) {
+                            loop.clear();
+                            break;
+                        }
+
+                        cur = next;
+                    }
+
+                    if( loop.size() >= 3 ) loops.push_back( std :: move( loop ) );
+                }
+
+                return loops;
+            }
+
+            static std :: vector< Region2 > _assemble( const std :: vector< Ring >& loops, const Vec2& org ) {
+                std :: vector< Region2 >       regions  = {};
+                std :: vector< const Ring* >   outlines = {};
+                std :: vector< T >             areas    = {};
+                std :: vector< Box2 >          boxes    = {};
+
+                for( const Ring& loop : loops ) {
+                    T area = _area2( loop );
+
+                    if( area <= 0.0 ) continue;
+
+                    regions.push_back( { _make( org, loop ) } );
+                    outlines.push_back( &loop );
+                    areas.push_back( area );
+                    boxes.push_back( _bounds( loop ) );
+                }
+
+                /* Each hole goes to the smallest outline around it. */
+                for( const Ring& loop : loops ) {
+                    if( _area2( loop ) >= 0.0 ) continue;
+
+                    const Vec2 probe = ( loop[ 0 ] + loop[ 1 ] ) / 2.0;
+                    size_t     owner = outlines.size();
+
+                    for( size_t idx = 0; idx < outlines.size(); ++idx ) {
+                        if( !boxes[ idx ].contains( probe ) || !_inside( *outlines[ idx ], probe ) ) continue;
+
+                        if( owner == outlines.size() || areas[ idx ] < areas[ owner ] ) owner = idx;
+                    }
+
+                    if( owner != outlines.size() ) regions[ owner ].holes.push_back( _make( org, loop ) );
+                }
+
+                return regions;
+            }
+
+        private:
+            static T _cross( const Vec2& a, const Vec2& b ) {
+                return a.x * b.y - a.y * b.x;
+            }
+
+            static T _area2( const Ring& ring ) {
+                T area = 0.0;
+
+                for( size_t idx = 0; idx < ring.size(); ++idx )
+                    area += _cross( ring[ idx ], ring[ ( idx + 1 ) % ring.size() ] );
+
+                return area;
+            }
+
+            /* Even-odd crossings, half-open in y so vertex heights count once. */
+            static bool _inside( const Ring& ring, const Vec2& vec ) {
+                bool in = false;
+
+                for( size_t idx = 0, prev = ring.size() - 1; idx < ring.size(); prev = idx++ ) {
+                    const Vec2& p = ring[ idx ];
+                    const Vec2& q = ring[ prev ];
+
+                    if( ( p.y > vec.y ) != ( q.y > vec.y ) && vec.x < p.x + ( vec.y - p.y ) * ( q.x - p.x ) / ( q.y - p.y ) )
+                        in = !in;
+                }
+
+                return in;
+            }
+
+            static void _dedup( Ring& ring ) {
+                ring.erase( std :: unique( ring.begin(), ring.end() ), ring.end() );
+
+                while( ring.size() > 1 && ring.front() == ring.back() ) ring.pop_back();
+            }
+
+            static Box2 _bounds( const Ring& ring ) {
+                Box2 box{ ring[ 0 ], ring[ 0 ] };
+
+                for( const Vec2& vec : ring ) {
+                    box.min = { std :: min( box.min.x, vec.x ), std :: min( box.min.y, vec.y ) };
+                    box.max = { std :: max( box.max.x, vec.x ), std :: max( box.max.y, vec.y ) };
+                }
+
+                return box;
+            }
+
+            static Box2 _edge_box( const Vec2& a, const Vec2& b ) {
+                return { { std :: min( a.x, b.x ), std :: min( a.y, b.y ) }, { std :: max( a.x, b.x ), std :: max( a.y, b.y ) } };
+            }
+
+            static bool _vec_less( const Vec2& a, const Vec2& b ) {
+                return a.x < b.x || ( a.x == b.x && a.y < b.y );
+            }
+
+            static bool _edge_less( const Edge& l, const Edge& r ) {
+                return _vec_less( l.from, r.from ) || ( l.from == r.from && _vec_less( l.to, r.to ) );
+            }
+
+            static Clust2 _make( const Vec2& org, const Ring& ring ) {
+                std :: vector< Vec2 > vrtx = {};
+
+                vrtx.reserve( ring.size() );
+
+                for( const Vec2& vec : ring )
+                    vrtx.push_back( vec - org );
+
+                return Clust2{ org, vrtx };
+            }
+
+        };
+
+
+        template< typename T >
+        std :: vector< Region2_t< T > > Clust2_t< T > :: clip( const Clust2& other, Boolean op ) const {
+            return Clip2 :: apply( *this, other, op );
+        }
+
+
+
+        /*
+            Bentley-Ottmann over a span of segments, each meeting pair reported once. The sweep runs along x
+            with ties broken by y, so vertical segments just sort last among those through a point. Interior
+            crossings swap neighbours in the status, touches and overlaps are reported where first seen.
+        */
+        template< typename T >
+        class Plane_sweep_t {
+        public:
+            typedef   Vec2_t< T >        Vec2;
+            typedef   Ray2_t< T >        Ray2;
+            typedef   Crossing2_t< T >   Crossing2;
+
+        private:
+            enum Kind {
+                END = 0, CROSS, START
+            };
+
+            enum Meet {
+                APART = 0, CROSSING, TOUCHING, OVERLAPPING
+            };
+
+            struct Seg {
+                Vec2     a   = {};
+                Vec2     b   = {};
+            };
+
+            struct Event {
+                Vec2     at     = {};
+                Kind     kind   = START;
+                size_t   s      = 0;
+                size_t   t      = 0;
+
+                bool operator < ( const Event& other ) const {
+                    if( _vec_less( at, other.at ) ) return true;
+                    if( _vec_less( other.at, at ) ) return false;
+
+                    return std :: tie( kind, s, t ) < std :: tie( other.kind, other.s, other.t );
+                }
+            };
+
+            /* Swaps rewrite the segment in place, the slots themselves never move. */
+            struct Slot {
+                mutable size_t   seg   = 0;
+            };
+
+            struct Below {
+                const Plane_sweep_t*   sweep   = nullptr;
+
+                bool operator () ( const Slot& l, const Slot& r ) const {
+                    return sweep -> _below( l.seg, r.seg );
+                }
+            };
+
+            typedef   std :: set< Slot, Below >   Status;
+
+        public:
+            static std :: vector< Crossing2 > crossings( std :: span< const Ray2 > rays, bool endpoints = false ) {
+                Plane_sweep_t sweep{ rays, endpoints };
+
+                sweep._run();
+
+                return std :: move( sweep._out );
+            }
+
+        private:
+            Plane_sweep_t( std :: span< const Ray2 > rays, bool endpoints )
+                : _status( Below{ this } ), _endpoints( endpoints )
+            {
+                _segs.reserve( rays.size() );
+
+                for( const Ray2& ray : rays ) {
+                    Seg seg{ ray.origin, ray.end() };
+
+                    if( _vec_less( seg.b, seg.a ) ) std :: swap( seg.a, seg.b );
+
+                    _segs.push_back( seg );
+                }
+
+                _where.resize( _segs.size(), _status.end() );
+            }
+
+        private:
+            std :: vector< Seg >                          _segs        = {};
+            Status                                        _status;
+            std :: vector< typename Status :: iterator >  _where       = {};
+            std :: set< Event >                           _events      = {};
+            std :: unordered_set< uint64_t >              _seen        = {};
+            std :: vector< Crossing2 >                    _out         = {};
+            Vec2                                          _at          = {};
+            bool                                          _endpoints   = false;
+
+        private:
+            void _run() {
+                std :: vector< Event > bounds{};
+
+                bounds.reserve( 2 * _segs.size() );
+
+                /* Zero length segments are left out. */
+                for( size_t idx = 0; idx < _segs.size(); ++idx ) {
+                    if( _segs[ idx ].a == _segs[ idx ].b ) continue;
+
+                    bounds.push_back( { _segs[ idx ].a, START, idx, idx } );
+                    bounds.push_back( { _segs[ idx ].b, END, idx, idx } );
+                }
+
+                std :: sort( bounds.begin(), bounds.end() );
+
+                _shared_ends( bounds );
+
+                if( !bounds.empty() ) _at = bounds.front().at;
+
+                for( size_t next = 0; next < bounds.size() || !_events.empty(); ) {
+                    Event event{};
+
+                    if( !_events.empty() && ( next == bounds.size() || *_events.begin() < bounds[ next ] ) ) {
+                        event = *_events.begin();
+                        _events.erase( _events.begin() );
+                    }
+                    else
+                        event = bounds[ next++ ];
+
+                    /* Crossings rounded behind the sweep still run, but never pull it back. */
+                    if( _vec_less( _at, event.at ) ) _at = event.at;
+
+                    switch( event.kind ) {
+                        case START: _insert( event.s ); break;
+                        case END:   _erase( event.s ); break;
+                        case CROSS: _swap( event.s, event.t ); break;
+                    }
+                }
+            }
+
+            /* Ends that coincide exactly never share the status, one has left before the other arrives. */
+            void _shared_ends( const std :: vector< Event >& bounds ) {
+                for( size_t begin = 0, end = 0; begin < bounds.size(); begin = end ) {
+                    for( end = begin + 1; end < bounds.size() && bounds[ end ].at == bounds[ begin ].at; ++end );
+
+                    for( size_t i = begin; i < end; ++i )
+                        for( size_t j = i + 1; j < end; ++j )
+                            if( bounds[ i ].s != bounds[ j ].s ) _report( bounds[ i ].s, bounds[ j ].s );
+                }
+            }
+
+            void _insert( size_t s ) {
+                auto itr = _status.insert( Slot{ s } ).first;
+
+                _where[ s ] = itr;
+
+                if( itr != _status.begin() ) _check( std :: prev( itr ) -> seg, s );
+                if( std :: next( itr ) != _status.end() ) _check( s, std :: next( itr ) -> seg );
+
+                _fan( itr, _segs[ s ].a );
+            }
+
+            void _erase( size_t s ) {
+                auto itr = _where[ s ];
+
+                _fan( itr, _segs[ s ].b );
+
+                auto next = _status.erase( itr );
+
+                _where[ s ] = _status.end();
+
+                if( next != _status.begin() && next != _status.end() ) _check( std :: prev( next ) -> seg, next -> seg );
+            }
+
+            void _swap( size_t lower, size_t upper ) {
+                auto l = _where[ lower ];
+                auto u = _where[ upper ];
+
+                /* Pairs pulled apart since scheduling come back once they are neighbours again. */
+                if( l == _status.end() || u == _status.end() || std :: next( l ) != u ) return;
+
+                std :: swap( l -> seg, u -> seg );
+                std :: swap( _where[ lower ], _where[ upper ] );
+
+                if( l != _status.begin() ) _check( std :: prev( l ) -> seg, upper );
+                if( std :: next( u ) != _status.end() ) _check( lower, std :: next( u ) -> seg );
+            }
+
+            /* Reports everything else through an end, these may sit further out than the direct neighbours. */
+            void _fan( typename Status :: iterator itr, const Vec2& at ) {
+                const size_t s = itr -> seg;
+
+                for( auto up = std :: next( itr ); up != _status.end() && _through( up -> seg, at ); ++up )
+                    _report( s, up -> seg );
+
+                for( auto down = itr; down != _status.begin() && _through( std :: prev( down ) -> seg, at ); --down )
+                    _report( s, std :: prev( down ) -> seg );
+            }
+
+            void _check( size_t lower, size_t upper ) {
+                auto [ meet, point ] = _meet( lower, upper );
+
+                if( meet == APART ) return;
+
+                _report( lower, upper );
+
+                if( meet == CROSSING && _steeper( lower, upper ) )
+                    _events.insert( { point, CROSS, lower, upper } );
+            }
+
+            void _report( size_t s, size_t t ) {
+                auto [ meet, point ] = _meet( s, t );
+
+                if( meet == APART ) return;
+
+                if( meet == TOUCHING && !_endpoints && _is_end( s, point ) && _is_end( t, point ) ) return;
+
+                if( s > t ) std :: swap( s, t );
+
+                if( !_seen.insert( uint64_t( s ) * _segs.size() + t ).second ) return;
+
+                _out.push_back( { point, s, t, meet == OVERLAPPING } );
+            }
+
+        private:
+            std :: pair< Meet, Vec2 > _meet( size_t s, size_t t ) const {
+                const Seg& p = _segs[ s ];
+                const Seg& q = _segs[ t ];
+
+                const Vec2 r  = p.b - p.a;
+                const Vec2 d  = q.b - q.a;
+                const Vec2 qp = q.a - p.a;
+
+                const T denom = _cross( r, d );
+
+                if( denom == 0.0 ) {
+                    if( _cross( qp, r ) != 0.0 ) return { APART, {} };
+
+                    const Vec2 lo = _vec_less( p.a, q.a ) ? q.a : p.a;
+                    const Vec2 hi = _vec_less( p.b, q.b ) ? p.b : q.b;
+
+                    if( _vec_less( hi, lo ) ) return { APART, {} };
+
+                    return { lo == hi ? TOUCHING : OVERLAPPING, lo };
+                }
+
+                const T u = _cross( qp, d ) / denom;
+                const T v = _cross( qp, r ) / denom;
+
+                if( u < 0.0 || u > 1.0 || v < 0.0 || v > 1.0 ) return { APART, {} };
+
+                if( u == 0.0 ) return { TOUCHING, p.a };
+                if( u == 1.0 ) return { TOUCHING, p.b };
+                if( v == 0.0 ) return { TOUCHING, q.a };
+                if( v == 1.0 ) return { TOUCHING, q.b };
+
+                return { CROSSING, p.a + r * u };
+            }
+
+            T _y_at( size_t s ) const {
+                const Seg& seg = _segs[ s ];
+
+                if( seg.a.x == seg.b.x ) return std :: clamp( _at.y, seg.a.y, seg.b.y );
+
+                if( _at.x == seg.a.x ) return seg.a.y;
+                if( _at.x == seg.b.x ) return seg.b.y;
+
+                return seg.a.y + ( _at.x - seg.a.x ) * ( seg.b.y - seg.a.y ) / ( seg.b.x - seg.a.x );
+            }
+
+            /* Order just past the sweep point, level segments by slope with verticals on top. */
+            bool _below( size_t l, size_t r ) const {
+                if( l == r ) return false;
+
+                const T yl = _y_at( l );
+                const T yr = _y_at( r );
+
+                if( yl != yr ) return yl < yr;
+
+                const Vec2 dl = _segs[ l ].b - _segs[ l ].a;
+                const Vec2 dr = _segs[ r ].b - _segs[ r ].a;
+
+                const T sl = dl.y * dr.x;
+                const T sr = dr.y * dl.x;
+
+                if( sl != sr ) return sl < sr;
+
+                return l < r;
+            }
+
+            bool _steeper( size_t l, size_t r ) const {
+                const Vec2 dl = _segs[ l ].b - _segs[ l ].a;
+                const Vec2 dr = _segs[ r ].b - _segs[ r ].a;
+
+                return dl.y * dr.x > dr.y * dl.x;
+            }
+
+            bool _through( size_t s, const Vec2& vec ) const {
+                const Seg& seg = _segs[ s ];
+
+                return !_vec_less( vec, seg.a ) && !_vec_less( seg.b, vec ) && _cross( seg.b - seg.a, vec - seg.a ) == 0.0;
+            }
+
+            bool _is_end( size_t s, const Vec2& vec ) const {
+                return _segs[ s ].a == vec || _segs[ s ].b == vec;
+            }
+
+            static T _cross( const Vec2& a, const Vec2& b ) {
+                return a.x * b.y - a.y * b.x;
+            }
+
+            static bool _vec_less( const Vec2& a, const Vec2& b ) {
+                return a.x < b.x || ( a.x == b.x && a.y < b.y );
+            }
+
+        };
+
+
+        template< typename T >
+        std :: vector< Crossing2_t< T > > Ray2_t< T > :: crossings( std :: span< const Ray2 > rays, bool endpoints ) {
+            return Plane_sweep_t< T > :: crossings( rays, endpoints );
+        }
+
+
+
+        /*
+            Signed distance baked on a grid of nodes, negative inside any of the baked outlines. Samples
+            blend the four surrounding nodes, outside the grid the distance to its border is added on.
+        */
+        template< typename T >
+        class Sdf2_t {
+        public:
+            typedef   Vec2_t< T >       Vec2;
+            typedef   Box2_t< T >       Box2;
+            typedef   Clust2_t< T >     Clust2;
+            typedef   Nearest2_t< T >   Nearest2;
+
+        public:
+            Sdf2_t() = default;
+
+            Sdf2_t( const Box2& bounds, T cell )
+                : _min( bounds.min ), _cell( cell ), _inv_cell( T( 1 ) / cell )
+            {
+                const Vec2 extent = bounds.extent();
+
+                /* At least one cell each way, samples always blend four nodes. */
+                _width  = std :: max< size_t >( 2, static_cast< size_t >( std :: ceil( static_cast< double >( extent.x / cell ) ) ) + 1 );
+                _height = std :: max< size_t >( 2, static_cast< size_t >( std :: ceil( static_cast< double >( extent.y / cell ) ) ) + 1 );
+
+                _values.assign( _width * _height, std :: numeric_limits< float > :: max() );
+            }
+
+        private:
+            Vec2                   _min        = {};
+            T                      _cell       = 1.0;
+            T                      _inv_cell   = 1.0;
+            size_t                 _width      = 0;
+            size_t                 _height     = 0;
+            std :: vector< float > _values     = {};
+
+        public:
+            size_t width() const {
+                return _width;
+            }
+
+            size_t height() const {
+                return _height;
+            }
+
+            T cell() const {
+                return _cell;
+            }
+
+            Box2 bounds() const {
+                return { _min, _min + Vec2{ _cell * T( _width - 1 ), _cell * T( _height - 1 ) } };
+            }
+
+            std :: span< const float > values() const {
+                return _values;
+            }
+
+            explicit operator bool () const {
+                return !_values.empty();
+            }
+
+        public:
+            /*
+                Rows are baked in parallel. Distances past range clamp to it, and outlines whose box lies
+                further than range from a row are skipped for that row. Outlines are settled up front.
+            */
+            Sdf2_t& bake( std :: span< const Clust2* const > clusts, T range = Scalar< T > :: inf(), size_t thread_count = 1 ) {
+                std :: vector< Box2 > boxes{};
+
+                boxes.reserve( clusts.size() );
+
+                for( const Clust2* clust : clusts ) {
+                    clust -> settle();
+
+                    boxes.push_back( clust -> box() );
+                }
+
+                parallel_for( _height, thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    std :: vector< Vec2 >     nodes( _width );
+                    std :: vector< Nearest2 > nearest( _width );
+                    std :: vector< T >        best( _width );
+
+                    for( size_t row = begin; row < end; ++row ) {
+                        const T y = _min.y + _cell * T( row );
+
+                        for( size_t col = 0; col < _width; ++col ) {
+                            nodes[ col ] = { _min.x + _cell * T( col ), y };
+                            best[ col ]  = range;
+                        }
+
+                        for( size_t idx = 0; idx < clusts.size(); ++idx ) {
+                            const Box2& box = boxes[ idx ];
+
+                            if( box.min.y - y > range || y - box.max.y > range ) continue;
+
+                            clusts[ idx ] -> signed_distance( nodes, nearest );
+
+                            for( size_t col = 0; col < _width; ++col )
+                                if( nearest[ col ].distance < best[ col ] ) best[ col ] = nearest[ col ].distance;
+                        }
+
+                        for( size_t col = 0; col < _width; ++col )
+                            _values[ row * _width + col ] = static_cast< float >( std :: max( best[ col ], -range ) );
+                    }
+                } );
+
+                return *this;
+            }
+
+        public:
+            /* Infinite for an empty grid, such as a failed load. */
+            T sample( const Vec2& vec ) const {
+                if( !*this ) return Scalar< T > :: inf();
+
+                auto [ col, row, fx, fy, out ] = _locate( vec );
+
+                const T v00 = _at( col, row );
+                const T v10 = _at( col + 1, row );
+                const T v01 = _at( col, row + 1 );
+                const T v11 = _at( col + 1, row + 1 );
+
+                const T bottom = v00 + ( v10 - v00 ) * fx;
+                const T top    = v01 + ( v11 - v01 ) * fx;
+
+                return bottom + ( top - bottom ) * fy + out;
+            }
+
+            /* Not normalised, zero for an empty grid. Outside the grid it points straight away from the border. */
+            Vec2 gradient( const Vec2& vec ) const {
+                if( !*this ) return {};
+
+                auto [ col, row, fx, fy, out ] = _locate( vec );
+
+                if( out > 0.0 ) {
+                    const Box2 box = bounds();
+                    const Vec2 pin = { std :: clamp( vec.x, box.min.x, box.max.x ), std :: clamp( vec.y, box.min.y, box.max.y ) };
+
+                    return ( vec - pin ) / out;
+                }
+
+                const T v00 = _at( col, row );
+                const T v10 = _at( col + 1, row );
+                const T v01 = _at( col, row + 1 );
+                const T v11 = _at( col + 1, row + 1 );
+
+                return {
+                    ( ( v10 - v00 ) * ( T( 1 ) - fy ) + ( v11 - v01 ) * fy ) * _inv_cell,
+                    ( ( v01 - v00 ) * ( T( 1 ) - fx ) + ( v11 - v10 ) * fx ) * _inv_cell
+                };
+            }
+
+            void sample( std :: span< const Vec2 > vecs, std :: span< T > out, size_t thread_count = 1 ) const {
+                parallel_for( std :: min( vecs.size(), out.size() ), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    for( size_t idx = begin; idx < end; ++idx )
+                        out[ idx ] = sample( vecs[ idx ] );
+                } );
+            }
+
+            void gradient( std :: span< const Vec2 > vecs, std :: span< Vec2 > out, size_t thread_count = 1 ) const {
+                parallel_for( std :: min( vecs.size(), out.size() ), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    for( size_t idx = begin; idx < end; ++idx )
+                        out[ idx ] = gradient( vecs[ idx ] );
+                } );
+            }
+
+        private:
+            struct Cell {
+                size_t   col   = 0;
+                size_t   row   = 0;
+                T        fx    = 0.0;
+                T        fy    = 0.0;
+                T        out   = 0.0;
+            };
+
+            T _at( size_t col, size_t row ) const {
+                return static_cast< T >( _values[ row * _width + col ] );
+            }
+
+            /* Pins to the border cell, out carries how far past the border vec lies. */
+            Cell _locate( const Vec2& vec ) const {
+                const T max_x = T( _width - 1 );
+                const T max_y = T( _height - 1 );
+
+                T gx = ( vec.x - _min.x ) * _inv_cell;
+                T gy = ( vec.y - _min.y ) * _inv_cell;
+
+                const T dx = gx < 0.0 ? -gx : gx > max_x ? gx - max_x : T( 0 );
+                const T dy = gy < 0.0 ? -gy : gy > max_y ? gy - max_y : T( 0 );
+
+                gx = std :: clamp( gx, T( 0 ), max_x );
+                gy = std :: clamp( gy, T( 0 ), max_y );
+
+                const size_t col = std :: min( static_cast< size_t >( gx ), _width > 1 ? _width - 2 : 0 );
+                const size_t row = std :: min( static_cast< size_t >( gy ), _height > 1 ? _height - 2 : 0 );
+
+                const T out = dx == 0.0 && dy == 0.0 ? T( 0 ) : Scalar< T > :: sqrt( dx * dx + dy * dy ) * _cell;
+
+                return { col, row, gx - T( col ), gy - T( row ), out };
+            }
+
+        public:
+            /*
+                Pack layout, little endian:
+                    header    "GSD2" | u16 version | u16 reserved | u32 width | u32 height
+                    frame     f64 min x | f64 min y | f64 cell
+                    values    f32[ width * height ], row by row from min
+            */
+            inline static constexpr char       PACK_MAGIC[ 4 ]   = { 'G', 'S', 'D', '2' };
+            inline static constexpr uint16_t   PACK_VERSION      = 1;
+
+            static Sdf2_t from_pack( std :: string_view path ) {
+                Mapped_file file{ path };
+
+                if( !file ) return {};
+
+                return from_bytes( file.bytes() );
+            }
+
+            static Sdf2_t from_bytes( std :: span< const char > bytes ) {
+                if( bytes.size() < 40 || std :: memcmp( bytes.data(), PACK_MAGIC, 4 ) != 0 ) return {};
+
+                uint16_t version = 0;
+                uint32_t dims[ 2 ];
+                double   frame[ 3 ];
+
+                std :: memcpy( &version, bytes.data() + 4, 2 );
+                std :: memcpy( dims, bytes.data() + 8, 8 );
+                std :: memcpy( frame, bytes.data() + 16, 24 );
+
+                const size_t count = size_t( dims[ 0 ] ) * dims[ 1 ];
+
+                if( version > PACK_VERSION || dims[ 0 ] < 2 || dims[ 1 ] < 2 ) return {};
+                if( count > ( bytes.size() - 40 ) / sizeof( float ) ) return {};
+                if( !( frame[ 2 ] > 0.0 ) || !std :: isfinite( frame[ 2 ] ) ) return {};
+
+                Sdf2_t sdf{};
+
+                sdf._min      = { static_cast< T >( frame[ 0 ] ), static_cast< T >( frame[ 1 ] ) };
+                sdf._cell     = static_cast< T >( frame[ 2 ] );
+                sdf._inv_cell = T( 1 ) / sdf._cell;
+                sdf._width    = dims[ 0 ];
+                sdf._height   = dims[ 1 ];
+
+                sdf._values.resize( count );
+                std :: memcpy( sdf._values.data(), bytes.data() + 40, count * sizeof( float ) );
+
+                return sdf;
+            }
+
+            bool to_pack( std :: string_view path ) const {
+                std :: ofstream file( path.data(), std :: ios_base :: binary );
+
+                if( !file ) return false;
+
+                const uint16_t version   = PACK_VERSION;
+                const uint16_t zero      = 0;
+                const uint32_t dims[ 2 ] = { static_cast< uint32_t >( _width ), static_cast< uint32_t >( _height ) };
+                const double   frame[ 3 ] = { static_cast< double >( _min.x ), static_cast< double >( _min.y ), static_cast< double >( _cell ) };
+
+                file.write( PACK_MAGIC, 4 );
+                file.write( reinterpret_cast< const char* >( &version ), 2 );
+                file.write( reinterpret_cast< const char* >( &zero ), 2 );
+                file.write( reinterpret_cast< const char* >( dims ), 8 );
+                file.write( reinterpret_cast< const char* >( frame ), 24 );
+                file.write( reinterpret_cast< const char* >( _values.data() ), _values.size() * sizeof( float ) );
+
+                return static_cast< bool >( file );
+            }
+
+        };
+
+
+
+        /*
+            Visibility polygon of a viewpoint among Clust2 obstacles, closed off by a bounding box. Edges are
+            split once where they cross or touch so that no two overlap inside, after which every viewpoint
+            is a single angular sweep keeping the edges under the current ray ordered front to back.
+        */
+        template< typename T >
+        class Visibility2_t {
+        public:
+            typedef   Vec2_t< T >        Vec2;
+            typedef   Ray2_t< T >        Ray2;
+            typedef   Box2_t< T >        Box2;
+            typedef   Clust2_t< T >      Clust2;
+            typedef   Crossing2_t< T >   Crossing2;
+
+        private:
+            struct Seg {
+                Vec2     a   = {};
+                Vec2     b   = {};
+            };
+
+            /* Endpoint direction from the viewpoint, the start being the first one counter-clockwise. */
+            struct Event {
+                Vec2     dir     = {};
+                size_t   seg     = 0;
+                bool     start   = false;
+            };
+
+            struct Front {
+                const Seg*   segs   = nullptr;
+                Vec2         eye    = {};
+
+                bool operator () ( size_t l, size_t r ) const {
+                    return l != r && _in_front( segs[ l ], segs[ r ], eye, l, r );
+                }
+            };
+
+        public:
+            Visibility2_t() = default;
+
+            Visibility2_t( std :: span< const Clust2* const > obstacles, const Box2& bounds )
+                : _bounds( bounds )
+            {
+                std :: vector< Ray2 > rays{};
+                std :: vector< Vec2 > tips{};
+
+                const Vec2 corners[ 4 ] = {
+                    bounds.min, { bounds.max.x, bounds.min.y }, bounds.max, { bounds.min.x, bounds.max.y }
+                };
+
+                for( size_t idx = 0; idx < 4; ++idx ) {
+                    rays.push_back( { corners[ idx ], corners[ ( idx + 1 ) % 4 ] - corners[ idx ] } );
+                    tips.push_back( corners[ ( idx + 1 ) % 4 ] );
+                }
+
+                for( const Clust2* clust : obstacles ) {
+                    const size_t n = clust -> vrtx_count();
+
+                    for( size_t idx = 0; idx < n; ++idx ) {
+                        const Vec2 a = ( *clust )( idx );
+                        const Vec2 b = ( *clust )( ( idx + 1 ) % n );
+
+                        if( a == b ) continue;
+
+                        rays.push_back( { a, b - a } );
+                        tips.push_back( b );
+                    }
+                }
+
+                _split( rays, tips );
+            }
+
+        private:
+            Box2                   _bounds   = {};
+            std :: vector< Seg >   _segs     = {};
+
+        public:
+            const Box2& bounds() const {
+                return _bounds;
+            }
+
+            size_t seg_count() const {
+                return _segs.size();
+            }
+
+        public:
+            /* Counter-clockwise, empty when the viewpoint is not strictly inside the bounds. */
+            Clust2 polygon( const Vec2& eye ) const {
+                if(
+                    eye.x <= _bounds.min.x || eye.x >= _bounds.max.x
+                    ||
+                    eye.y <= _bounds.min.y || eye.y >= _bounds.max.y
+                ) return {};
+
+                std :: vector< Event >  events{};
+                std :: vector< size_t > wraps{};
+
+                events.reserve( 2 * _segs.size() );
+
+                for( size_t idx = 0; idx < _segs.size(); ++idx ) {
+                    const Vec2 da = _segs[ idx ].a - eye;
+                    const Vec2 db = _segs[ idx ].b - eye;
+                    const T    turn = _cross( da, db );
+
+                    /* Edges seen end-on cover no angle. */
+                    if( turn == 0.0 ) continue;
+
+                    const Vec2 from = turn > 0.0 ? da : db;
+                    const Vec2 to   = turn > 0.0 ? db : da;
+
+                    events.push_back( { from, idx, true } );
+                    events.push_back( { to, idx, false } );
+
+                    /* Spans across the start of the angular order, so already under the first ray. */
+                    if( _angle_less( to, from ) ) wraps.push_back( idx );
+                }
+
+                std :: sort( events.begin(), events.end(), [] ( const Event& l, const Event& r ) -> bool {
+                    if( _angle_less( l.dir, r.dir ) ) return true;
+                    if( _angle_less( r.dir, l.dir ) ) return false;
+
+                    return l.start < r.start;
+                } );
+
+                std :: set< size_t, Front >                         active( Front{ _segs.data(), eye } );
+                std :: vector< typename std :: set< size_t, Front > :: iterator > where( _segs.size(), active.end() );
+                std :: vector< Vec2 >                               vrtx{};
+
+                for( size_t seg : wraps )
+                    where[ seg ] = active.insert( seg ).first;
+
+                for( size_t begin = 0, end = 0; begin < events.size(); begin = end ) {
+                    const Vec2 dir = events[ begin ].dir;
+
+                    for( end = begin + 1; end < events.size() && !_angle_less( dir, events[ end ].dir ); ++end );
+
+                    const size_t before = active.empty() ? _segs.size() : *active.begin();
+
+                    for( size_t idx = begin; idx < end; ++idx ) {
+                        const size_t seg = events[ idx ].seg;
+
+                        if( events[ idx ].start ) {
+                            where[ seg ] = active.insert( seg ).first;
+
+                            continue;
+                        }
+
+                        if( where[ seg ] != active.end() ) active.erase( where[ seg ] );
+
+                        where[ seg ] = active.end();
+                    }
+
+                    const size_t after = active.empty() ? _segs.size() : *active.begin();
+
+                    if( before == after ) continue;
+
+                    if( before != _segs.size() ) _push( vrtx, _along( _segs[ before ], eye, dir ) );
+                    if( after != _segs.size() )  _push( vrtx, _along( _segs[ after ], eye, dir ) );
+                }
+
+                while( vrtx.size() > 1 && vrtx.front() == vrtx.back() ) vrtx.pop_back();
+
+                if( vrtx.size() < 3 ) return {};
+
+                for( Vec2& vec : vrtx ) vec -= eye;
+
+                return Clust2{ eye, vrtx };
+            }
+
+            /* One polygon per viewpoint, the viewpoints split across threads. */
+            void polygons( std :: span< const Vec2 > eyes, std :: span< Clust2 > out, size_t thread_count = 1 ) const {
+                parallel_for( std :: min( eyes.size(), out.size() ), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    for( size_t idx = begin; idx < end; ++idx )
+                        out[ idx ] = polygon( eyes[ idx ] );
+                } );
+            }
+
+        private:
+            /* Tips are the true far ends, origin plus vec may miss the next vertex by rounding. */
+            void _split( std :: span< const Ray2 > rays, std :: span< const Vec2 > tips ) {
+                std :: vector< std :: vector< std :: pair< T, Vec2 > > > cuts( rays.size() );
+
+                /* Pieces end on the reported points themselves, so neighbours share them exactly. */
+                for( const Crossing2& crossing : Ray2 :: crossings( rays ) ) {
+                    for( size_t idx : { crossing.first, crossing.second } ) {
+                        const Ray2& ray = rays[ idx ];
+
+                        cuts[ idx ].push_back( { ( crossing.point - ray.origin ).dot( ray.vec ) / ray.vec.mag_sq(), crossing.point } );
+                    }
+                }
+
+                for( size_t idx = 0; idx < rays.size(); ++idx ) {
+                    auto& ts = cuts[ idx ];
+
+                    std :: sort( ts.begin(), ts.end(), [] ( const auto& l, const auto& r ) -> bool { return l.first < r.first; } );
+
+                    Vec2 from = rays[ idx ].origin;
+
+                    for( const auto& [ t, to ] : ts ) {
+                        if( t <= 0.0 || t >= 1.0 || to == from ) continue;
+
+                        _segs.push_back( { from, to } );
+
+                        from = to;
+                    }
+
+                    if( from != tips[ idx ] ) _segs.push_back( { from, tips[ idx ] } );
+                }
+            }
+
+            /*
+                Compares along a ray strictly inside the angle both edges cover. Edges that only meet at their
+                ends, which the split guarantees, keep that order for as long as both are under the sweep.
+            */
+            static bool _in_front( const Seg& l, const Seg& r, const Vec2& eye, size_t li, size_t ri ) {
+                Vec2 la = l.a - eye, lb = l.b - eye;
+                Vec2 ra = r.a - eye, rb = r.b - eye;
+
+                if( _cross( la, lb ) < 0.0 ) std :: swap( la, lb );
+                if( _cross( ra, rb ) < 0.0 ) std :: swap( ra, rb );
+
+                const Vec2 from = _cross( la, ra ) > 0.0 ? ra : la;
+                const Vec2 to   = _cross( lb, rb ) > 0.0 ? lb : rb;
+                const Vec2 dir  = from + to;
+
+                const T tl = _cross( la, l.b - l.a ) / _cross( dir, l.b - l.a );
+                const T tr = _cross( ra, r.b - r.a ) / _cross( dir, r.b - r.a );
+
+                if( tl != tr ) return tl < tr;
+
+                return li < ri;
+            }
+
+            /* Where the ray from eye along dir meets the line through seg. */
+            static Vec2 _along( const Seg& seg, const Vec2& eye, const Vec2& dir ) {
+                const Vec2 d     = seg.b - seg.a;
+                const T    denom = _cross( dir, d );
+
+                if( denom == 0.0 ) return ( seg.a - eye ).mag_sq() < ( seg.b - eye ).mag_sq() ? seg.a : seg.b;
+
+                return eye + dir * ( _cross( seg.a - eye, d ) / denom );
+            }
+
+            static void _push( std :: vector< Vec2 >& vrtx, const Vec2& vec ) {
+                if( vrtx.empty() || vrtx.back() != vec ) vrtx.push_back( vec );
+            }
+
+            /* Counter-clockwise from the positive x axis, exact on the direction vectors themselves. */
+            static bool _angle_less( const Vec2& l, const Vec2& r ) {
+                const bool hl = l.y < 0.0 || ( l.y == 0.0 && l.x < 0.0 );
+                const bool hr = r.y < 0.0 || ( r.y == 0.0 && r.x < 0.0 );
+
+                if( hl != hr ) return hr;
+
+                return _cross( l, r ) > 0.0;
+            }
+
+            static T _cross( const Vec2& a, const Vec2& b ) {
+                return a.x * b.y - a.y * b.x;
+            }
+
+        };
+
+
+
+        /*
+            Navigation mesh over the free space of a boundary, cut into trapezoids by a sweep along x. Every
+            edge, the boundary's included, is inflated to a capsule of the agent radius, so obstacles never
+            need merging: a trapezoid is free when it lies inside the boundary and inside none of the inflated
+            shapes. Neighbouring trapezoids meet on vertical portals, paths are A* over the cells pulled tight
+            through those portals by a funnel.
+        */
+        template< typename T >
+        class Navmesh2_t {
+        public:
+            typedef   Vec2_t< T >        Vec2;
+            typedef   Ray2_t< T >        Ray2;
+            typedef   Box2_t< T >        Box2;
+            typedef   Clust2_t< T >      Clust2;
+            typedef   Crossing2_t< T >   Crossing2;
+
+        private:
+            enum Side {
+                WALK = 0, BLOCK
+            };
+
+            /* Wind is what crossing the edge upwards adds to the count of its side. */
+            struct Edge {
+                Vec2     a      = {};
+                Vec2     b      = {};
+                Side     side   = WALK;
+                int      wind   = 0;
+            };
+
+            /* Bottom from b0 to b1, top from t0 to t1. */
+            struct Cell {
+                Vec2     b0   = {};
+                Vec2     b1   = {};
+                Vec2     t0   = {};
+                Vec2     t1   = {};
+            };
+
+            struct Portal {
+                size_t   to   = 0;
+                Vec2     lo   = {};
+                Vec2     hi   = {};
+            };
+
+            /* Edges as rays for the crossing sweep, with their true far vertex and their tag alongside. */
+            struct Outline {
+                std :: vector< Ray2 >                       rays   = {};
+                std :: vector< Vec2 >                       tips   = {};
+                std :: vector< std :: pair< Side, int > >   tags   = {};
+            };
+
+            inline static constexpr size_t   NONE   = std :: numeric_limits< size_t > :: max();
+
+        public:
+            /* Query state reused across queries, one per thread. Stamped, so a query never has to clear it. */
+            struct Scratch {
+                std :: vector< T >                           g        = {};
+                std :: vector< size_t >                      parent   = {};
+                std :: vector< size_t >                      via      = {};
+                std :: vector< Vec2 >                        entry    = {};
+                std :: vector< uint32_t >                    stamp    = {};
+                std :: vector< std :: pair< T, size_t > >    open     = {};
+                std :: vector< std :: pair< Vec2, Vec2 > >   gates    = {};
+                std :: vector< size_t >                      chain    = {};
+                uint32_t                                     gen      = 0;
+            };
+
+        public:
+            Navmesh2_t() = default;
+
+            Navmesh2_t( const Clust2& boundary, std :: span< const Clust2* const > obstacles, T radius = 0.0, size_t arc_steps = 3 ) {
+                Outline outline{};
+
+                _add( outline, _ring( boundary ), WALK, radius, arc_steps );
+
+                for( const Clust2* clust : obstacles )
+                    _add( outline, _ring( *clust ), BLOCK, radius, arc_steps );
+
+                _sweep( _split( outline ) );
+                _index();
+            }
+
+        private:
+            std :: vector< Cell >     _cells        = {};
+            std :: vector< size_t >   _first        = {};
+            std :: vector< Portal >   _portals      = {};
+
+            Vec2                      _grid_min     = {};
+            Vec2                      _grid_step    = {};
+            size_t                    _grid_w       = 0;
+            size_t                    _grid_h       = 0;
+            std :: vector< size_t >   _grid_first   = {};
+            std :: vector< size_t >   _grid_items   = {};
+
+        public:
+            size_t cell_count() const {
+                return _cells.size();
+            }
+
+            size_t portal_count() const {
+                return _portals.size() / 2;
+            }
+
+            Clust2 cell( size_t idx ) const {
+                const Cell& cell = _cells[ idx ];
+                const Vec2  mid  = ( cell.b0 + cell.b1 + cell.t0 + cell.t1 ) / T( 4 );
+
+                std :: vector< Vec2 > vrtx{};
+
+                for( const Vec2& vec : { cell.b0, cell.b1, cell.t1, cell.t0 } )
+                    if( vrtx.empty() || vrtx.back() != vec ) vrtx.push_back( vec );
+
+                if( vrtx.size() > 1 && vrtx.front() == vrtx.back() ) vrtx.pop_back();
+
+                for( Vec2& vec : vrtx ) vec -= mid;
+
+                return Clust2{ mid, vrtx };
+            }
+
+            std :: optional< size_t > locate( const Vec2& vec ) const {
+                if( _cells.empty() ) return {};
+
+                const T gx = ( vec.x - _grid_min.x ) / _grid_step.x;
+                const T gy = ( vec.y - _grid_min.y ) / _grid_step.y;
+
+                if( gx < 0.0 || gy < 0.0 || gx > T( _grid_w ) || gy > T( _grid_h ) ) return {};
+
+                const size_t col    = std :: min( static_cast< size_t >( gx ), _grid_w - 1 );
+                const size_t row    = std :: min( static_cast< size_t >( gy ), _grid_h - 1 );
+                const size_t bucket = row * _grid_w + col;
+
+                for( size_t idx = _grid_first[ bucket ]; idx < _grid_first[ bucket + 1 ]; ++idx )
+                    if( _inside( _cells[ _grid_items[ idx ] ], vec ) ) return _grid_items[ idx ];
+
+                return {};
+            }
+
+        public:
+            /* Corners from from to to, empty when either end is off the mesh or they are not connected. */
+            std :: vector< Vec2 > path( const Vec2& from, const Vec2& to, Scratch& scratch ) const {
+                const auto start = locate( from );
+                const auto goal  = locate( to );
+
+                if( !start || !goal ) return {};
+
+                if( *start == *goal ) return { from, to };
+
+                if( !_search( *start, *goal, from, to, scratch ) ) return {};
+
+                auto& chain = scratch.chain;
+
+                chain.clear();
+
+                for( size_t at = *goal; at != *start; at = scratch.parent[ at ] )
+                    chain.push_back( at );
+
+                scratch.gates.clear();
+                scratch.gates.push_back( { from, from } );
+
+                for( size_t idx = chain.size(); idx-- > 0; ) {
+                    const Portal& portal = _portals[ scratch.via[ chain[ idx ] ] ];
+                    const bool    right  = portal.lo.x == _cells[ scratch.parent[ chain[ idx ] ] ].b1.x;
+
+                    scratch.gates.push_back( right ? std :: make_pair( portal.hi, portal.lo ) : std :: make_pair( portal.lo, portal.hi ) );
+                }
+
+                scratch.gates.push_back( { to, to } );
+
+                return _funnel( scratch.gates );
+            }
+
+            std :: vector< Vec2 > path( const Vec2& from, const Vec2& to ) const {
+                Scratch scratch{};
+
+                return path( from, to, scratch );
+            }
+
+            /* Each thread keeps one scratch across its share of the queries. */
+            void paths( std :: span< const std :: pair< Vec2, Vec2 > > queries, std :: span< std :: vector< Vec2 > > out, size_t thread_count = 1 ) const {
+                parallel_for( std :: min( queries.size(), out.size() ), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    Scratch scratch{};
+
+                    for( size_t idx = begin; idx < end; ++idx )
+                        out[ idx ] = path( queries[ idx ].first, queries[ idx ].second, scratch );
+                } );
+            }
+
+        private:
+            /* World vertices, counter-clockwise and without repeats. */
+            static std :: vector< Vec2 > _ring( const Clust2& clust ) {
+                std :: vector< Vec2 > vrtx{};
+                T                     area = 0.0;
+
+                for( size_t idx = 0; idx < clust.vrtx_count(); ++idx )
+                    if( vrtx.empty() || vrtx.back() != clust( idx ) ) vrtx.push_back( clust( idx ) );
+
+                while( vrtx.size() > 1 && vrtx.front() == vrtx.back() ) vrtx.pop_back();
+
+                for( size_t idx = 0; idx < vrtx.size(); ++idx )
+                    area += _cross( vrtx[ idx ], vrtx[ ( idx + 1 ) % vrtx.size() ] );
+
+                if( area < 0.0 ) std :: reverse( vrtx.begin(), vrtx.end() );
+
+                return vrtx;
+            }
+
+            static void _add( Outline& outline, const std :: vector< Vec2 >& ring, Side side, T radius, size_t arc_steps ) {
+                if( ring.size() < 3 ) return;
+
+                _edges( outline, ring, side );
+
+                if( radius <= 0.0 ) return;
+
+                for( size_t idx = 0; idx < ring.size(); ++idx )
+                    _edges( outline, _capsule( ring[ idx ], ring[ ( idx + 1 ) % ring.size() ], radius, arc_steps ), BLOCK );
+            }
+
+            /* Counter-clockwise ring winds up by one crossing its bottom edges, which run towards +x. */
+            static void _edges( Outline& outline, const std :: vector< Vec2 >& ring, Side side ) {
+                for( size_t idx = 0; idx < ring.size(); ++idx ) {
+                    const Vec2& a = ring[ idx ];
+                    const Vec2& b = ring[ ( idx + 1 ) % ring.size() ];
+
+                    outline.rays.push_back( { a, b - a } );
+                    outline.tips.push_back( b );
+                    outline.tags.push_back( { side, b.x > a.x ? 1 : b.x < a.x ? -1 : 0 } );
+                }
+            }
+
+            /* Caps circumscribe the circle, the straight sides sit exactly at radius. */
+            static std :: vector< Vec2 > _capsule( const Vec2& a, const Vec2& b, T radius, size_t arc_steps ) {
+                const Vec2 d    = ( b - a ) / ( b - a ).mag();
+                const Vec2 n    = { -d.y, d.x };
+                const T    half = T( PI / ( 2.0 * static_cast< double >( std :: max< size_t >( arc_steps, 1 ) ) ) );
+                const T    far  = radius / Scalar< T > :: cos( half );
+
+                std :: vector< Vec2 > vrtx{};
+
+                for( const auto& [ at, from ] : { std :: make_pair( b, -n ), std :: make_pair( a, n ) } ) {
+                    const Vec2 turn = { -from.y, from.x };
+
+                    vrtx.push_back( at + from * radius );
+
+                    for( size_t step = 0; step < arc_steps; ++step ) {
+                        const T angle = half * T( 2 * step + 1 );
+
+                        vrtx.push_back( at + ( from * Scalar< T > :: cos( angle ) + turn * Scalar< T > :: sin( angle ) ) * far );
+                    }
+
+                    vrtx.push_back( at - from * radius );
+                }
+
+                return vrtx;
+            }
+
+            /* Pieces end on the reported points themselves, so neighbours share them exactly. Verticals drop out. */
+            static std :: vector< Edge > _split( const Outline& outline ) {
+                const auto& rays = outline.rays;
+                const auto& tags = outline.tags;
+
+                std :: vector< std :: vector< std :: pair< T, Vec2 > > > cuts( rays.size() );
+
+                for( const Crossing2& crossing : Ray2 :: crossings( rays ) ) {
+                    for( size_t idx : { crossing.first, crossing.second } ) {
+                        const Ray2& ray = rays[ idx ];
+
+                        cuts[ idx ].push_back( { ( crossing.point - ray.origin ).dot( ray.vec ) / ray.vec.mag_sq(), crossing.point } );
+                    }
+                }
+
+                std :: vector< Edge > edges{};
+
+                auto push = [ & ] ( Vec2 a, Vec2 b, size_t idx ) -> void {
+                    if( a.x == b.x ) return;
+
+                    if( b.x < a.x ) std :: swap( a, b );
+
+                    edges.push_back( { a, b, tags[ idx ].first, tags[ idx ].second } );
+                };
+
+                for( size_t idx = 0; idx < rays.size(); ++idx ) {
+                    auto& ts = cuts[ idx ];
+
+                    std :: sort( ts.begin(), ts.end(), [] ( const auto& l, const auto& r ) -> bool { return l.first < r.first; } );
+
+                    Vec2 from = rays[ idx ].origin;
+
+                    for( const auto& [ t, to ] : ts ) {
+                        if( t <= 0.0 || t >= 1.0 || to == from ) continue;
+
+                        push( from, to, idx );
+
+                        from = to;
+                    }
+
+                    push( from, outline.tips[ idx ], idx );
+                }
+
+                return edges;
+            }
+
+            /*
+                Between two consecutive x stops the edges under the sweep never cross, so their order holds
+                and the gaps between them are trapezoids. A gap bounded by the same two edges as before carries
+                its cell on, everything else closes at the stop and opens anew, and the closed and opened cells
+                overlapping along the stop become portals.
+            */
+            void _sweep( const std :: vector< Edge >& edges ) {
+                struct Open {
+                    size_t   lo     = 0;
+                    size_t   hi     = 0;
+                    size_t   cell   = NONE;
+                };
+
+                std :: vector< T > xs{};
+
+                xs.reserve( 2 * edges.size() );
+
+                for( const Edge& edge : edges ) {
+                    xs.push_back( edge.a.x );
+                    xs.push_back( edge.b.x );
+                }
+
+                std :: sort( xs.begin(), xs.end() );
+                xs.erase( std :: unique( xs.begin(), xs.end() ), xs.end() );
+
+                std :: vector< size_t > starts( edges.size() );
+                std :: vector< size_t > ends( edges.size() );
+
+                std :: iota( starts.begin(), starts.end(), 0 );
+                std :: iota( ends.begin(), ends.end(), 0 );
+
+                std :: sort( starts.begin(), starts.end(), [ & ] ( size_t l, size_t r ) -> bool { return edges[ l ].a.x < edges[ r ].a.x; } );
+                std :: sort( ends.begin(), ends.end(), [ & ] ( size_t l, size_t r ) -> bool { return edges[ l ].b.x < edges[ r ].b.x; } );
+
+                std :: vector< size_t >                            status{};
+                std :: vector< Open >                              open{};
+                std :: vector< Open >                              next{};
+                std :: vector< size_t >                            closed{};
+                std :: vector< size_t >                            opened{};
+                std :: unordered_map< uint64_t, size_t >           carry{};
+                std :: vector< std :: pair< size_t, Portal > >     links{};
+
+                for( size_t stop = 0, s = 0, e = 0; stop < xs.size(); ++stop ) {
+                    const T x = xs[ stop ];
+
+                    for( ; e < ends.size() && edges[ ends[ e ] ].b.x == x; ++e )
+                        status.erase( std :: find( status.begin(), status.end(), ends[ e ] ) );
+
+                    const bool last = stop + 1 == xs.size();
+                    const T    mid  = last ? x : ( x + xs[ stop + 1 ] ) / T( 2 );
+
+                    for( ; s < starts.size() && edges[ starts[ s ] ].a.x == x; ++s ) {
+                        const T y = _y_at( edges[ starts[ s ] ], mid );
+
+                        status.insert(
+                            std :: lower_bound( status.begin(), status.end(), y, [ & ] ( size_t idx, T key ) -> bool { return _y_at( edges[ idx ], mid ) < key; } ),
+                            starts[ s ]
+                        );
+                    }
+
+                    next.clear();
+
+                    int walk  = 0;
+                    int block = 0;
+
+                    for( size_t idx = 0; !last && idx + 1 < status.size(); ++idx ) {
+                        const Edge& lo = edges[ status[ idx ] ];
+                        const Edge& hi = edges[ status[ idx + 1 ] ];
+
+                        ( lo.side == WALK ? walk : block ) += lo.wind;
+
+                        if( walk > 0 && block == 0 && _y_at( hi, mid ) > _y_at( lo, mid ) )
+                            next.push_back( { status[ idx ], status[ idx + 1 ], NONE } );
+                    }
+
+                    carry.clear();
+
+                    for( size_t idx = 0; idx < open.size(); ++idx )
+                        carry[ _key( open[ idx ].lo, open[ idx ].hi, edges.size() ) ] = idx;
+
+                    opened.clear();
+
+                    for( Open& gap : next ) {
+                        auto itr = carry.find( _key( gap.lo, gap.hi, edges.size() ) );
+
+                        if( itr != carry.end() ) {
+                            gap.cell = open[ itr -> second ].cell;
+                            open[ itr -> second ].cell = NONE;
+
+                            continue;
+                        }
+
+                        gap.cell = _cells.size();
+
+                        _cells.push_back( { { x, _y_at( edges[ gap.lo ], x ) }, {}, { x, _y_at( edges[ gap.hi ], x ) }, {} } );
+                        opened.push_back( gap.cell );
+                    }
+
+                    closed.clear();
+
+                    for( const Open& gap : open ) {
+                        if( gap.cell == NONE ) continue;
+
+                        _cells[ gap.cell ].b1 = { x, _y_at( edges[ gap.lo ], x ) };
+                        _cells[ gap.cell ].t1 = { x, _y_at( edges[ gap.hi ], x ) };
+
+                        closed.push_back( gap.cell );
+                    }
+
+                    for( size_t l = 0, r = 0; l < closed.size() && r < opened.size(); ) {
+                        const Cell& left  = _cells[ closed[ l ] ];
+                        const Cell& right = _cells[ opened[ r ] ];
+
+                        const T lo = std :: max( left.b1.y, right.b0.y );
+                        const T hi = std :: min( left.t1.y, right.t0.y );
+
+                        if( hi > lo ) {
+                            links.push_back( { closed[ l ], { opened[ r ], { x, lo }, { x, hi } } } );
+                            links.push_back( { opened[ r ], { closed[ l ], { x, lo }, { x, hi } } } );
+                        }
+
+                        if( left.t1.y < right.t0.y ) ++l; else ++r;
+                    }
+
+                    open.swap( next );
+                }
+
+                std :: stable_sort( links.begin(), links.end(), [] ( const auto& l, const auto& r ) -> bool { return l.first < r.first; } );
+
+                _first.assign( _cells.size() + 1, 0 );
+                _portals.clear();
+                _portals.reserve( links.size() );
+
+                for( const auto& [ from, portal ] : links ) {
+                    ++_first[ from + 1 ];
+                    _portals.push_back( portal );
+                }
+
+                for( size_t idx = 0; idx < _cells.size(); ++idx )
+                    _first[ idx + 1 ] += _first[ idx ];
+            }
+
+            /* Buckets roughly one cell each, cells listed in every bucket their box touches. */
+            void _index() {
+                if( _cells.empty() ) return;
+
+                Vec2 lo = _cells.front().b0;
+                Vec2 hi = _cells.front().t1;
+
+                for( const Cell& cell : _cells ) {
+                    lo = { std :: min( lo.x, cell.b0.x ), std :: min( { lo.y, cell.b0.y, cell.b1.y } ) };
+                    hi = { std :: max( hi.x, cell.b1.x ), std :: max( { hi.y, cell.t0.y, cell.t1.y } ) };
+                }
+
+                _grid_w    = std :: max< size_t >( 1, static_cast< size_t >( std :: sqrt( static_cast< double >( _cells.size() ) ) ) );
+                _grid_h    = _grid_w;
+                _grid_min  = lo;
+                _grid_step = { std :: max( ( hi.x - lo.x ) / T( _grid_w ), Scalar< T > :: eps() ), std :: max( ( hi.y - lo.y ) / T( _grid_h ), Scalar< T > :: eps() ) };
+
+                auto span_of = [ & ] ( const Cell& cell ) -> std :: array< size_t, 4 > {
+                    auto clamp = [] ( T v, size_t n ) -> size_t {
+                        return v <= 0.0 ? 0 : std :: min( static_cast< size_t >( v ), n - 1 );
+                    };
+
+                    return {
+                        clamp( ( cell.b0.x - lo.x ) / _grid_step.x, _grid_w ),
+                        clamp( ( cell.b1.x - lo.x ) / _grid_step.x, _grid_w ),
+                        clamp( ( std :: min( cell.b0.y, cell.b1.y ) - lo.y ) / _grid_step.y, _grid_h ),
+                        clamp( ( std :: max( cell.t0.y, cell.t1.y ) - lo.y ) / _grid_step.y, _grid_h )
+                    };
+                };
+
+                _grid_first.assign( _grid_w * _grid_h + 1, 0 );
+
+                for( const Cell& cell : _cells ) {
+                    const auto [ c0, c1, r0, r1 ] = span_of( cell );
+
+                    for( size_t row = r0; row <= r1; ++row )
+                        for( size_t col = c0; col <= c1; ++col )
+                            ++_grid_first[ row * _grid_w + col + 1 ];
+                }
+
+                for( size_t idx = 0; idx + 1 < _grid_first.size(); ++idx )
+                    _grid_first[ idx + 1 ] += _grid_first[ idx ];
+
+                std :: vector< size_t > fill( _grid_first.begin(), _grid_first.end() - 1 );
+
+                _grid_items.resize( _grid_first.back() );
+
+                for( size_t idx = 0; idx < _cells.size(); ++idx ) {
+                    const auto [ c0, c1, r0, r1 ] = span_of( _cells[ idx ] );
+
+                    for( size_t row = r0; row <= r1; ++row )
+                        for( size_t col = c0; col <= c1; ++col )
+                            _grid_items[ fill[ row * _grid_w + col ]++ ] = idx;
+                }
+            }
+
+        private:
+            /* Steps between cells through the portal point nearest the straight line from entry to goal. */
+            bool _search( size_t start, size_t goal, const Vec2& from, const Vec2& to, Scratch& scratch ) const {
+                if( scratch.stamp.size() != _cells.size() ) {
+                    scratch.g.resize( _cells.size() );
+                    scratch.parent.resize( _cells.size() );
+                    scratch.via.resize( _cells.size() );
+                    scratch.entry.resize( _cells.size() );
+                    scratch.stamp.assign( _cells.size(), 0 );
+                    scratch.gen = 0;
+                }
+
+                if( ++scratch.gen == 0 ) {
+                    std :: fill( scratch.stamp.begin(), scratch.stamp.end(), 0 );
+                    scratch.gen = 1;
+                }
+
+                auto& open = scratch.open;
+
+                open.clear();
+
+                scratch.g[ start ]      = 0.0;
+                scratch.entry[ start ]  = from;
+                scratch.parent[ start ] = NONE;
+                scratch.stamp[ start ]  = scratch.gen;
+
+                open.push_back( { from.dist_to( to ), start } );
+
+                while( !open.empty() ) {
+                    std :: pop_heap( open.begin(), open.end(), std :: greater<>{} );
+
+                    const auto [ f, at ] = open.back();
+
+                    open.pop_back();
+
+                    if( at == goal ) return true;
+
+                    const Vec2& entry = scratch.entry[ at ];
+
+                    if( f > scratch.g[ at ] + entry.dist_to( to ) ) continue;
+
+                    for( size_t idx = _first[ at ]; idx < _first[ at + 1 ]; ++idx ) {
+                        const Portal& portal = _portals[ idx ];
+                        const Vec2    cross  = _gate_point( portal, entry, to );
+                        const T       g      = scratch.g[ at ] + entry.dist_to( cross );
+
+                        if( scratch.stamp[ portal.to ] == scratch.gen && g >= scratch.g[ portal.to ] ) continue;
+
+                        scratch.stamp[ portal.to ]  = scratch.gen;
+                        scratch.g[ portal.to ]      = g;
+                        scratch.entry[ portal.to ]  = cross;
+                        scratch.parent[ portal.to ] = at;
+                        scratch.via[ portal.to ]    = idx;
+
+                        open.push_back( { g + cross.dist_to( to ), portal.to } );
+                        std :: push_heap( open.begin(), open.end(), std :: greater<>{} );
+                    }
+                }
+
+                return false;
+            }
+
+            static Vec2 _gate_point( const Portal& portal, const Vec2& entry, const Vec2& to ) {
+                T y = entry.y;
+
+                if( to.x != entry.x ) y = entry.y + ( portal.lo.x - entry.x ) * ( to.y - entry.y ) / ( to.x - entry.x );
+
+                return { portal.lo.x, std :: clamp( y, portal.lo.y, portal.hi.y ) };
+            }
+
+            /* Gates are left, right pairs as seen walking through them. */
+            static std :: vector< Vec2 > _funnel( const std :: vector< std :: pair< Vec2, Vec2 > >& gates ) {
+                std :: vector< Vec2 > corners{ gates.front().first };
+
+                Vec2   apex  = gates.front().first;
+                Vec2   left  = apex;
+                Vec2   right = apex;
+                size_t apex_at  = 0;
+                size_t left_at  = 0;
+                size_t right_at = 0;
+
+                for( size_t idx = 1; idx < gates.size(); ++idx ) {
+                    const auto& [ l, r ] = gates[ idx ];
+
+                    if( _cross( right - apex, r - apex ) >= 0.0 ) {
+                        if( apex == right || _cross( left - apex, r - apex ) < 0.0 ) {
+                            right    = r;
+                            right_at = idx;
+                        }
+                        else {
+                            if( corners.back() != left ) corners.push_back( left );
+
+                            apex  = left;
+                            right = left;
+                            idx   = apex_at = right_at = left_at;
+
+                            continue;
+                        }
+                    }
+
+                    if( _cross( left - apex, l - apex ) <= 0.0 ) {
+                        if( apex == left || _cross( right - apex, l - apex ) > 0.0 ) {
+                            left    = l;
+                            left_at = idx;
+                        }
+                        else {
+                            if( corners.back() != right ) corners.push_back( right );
+
+                            apex = right;
+                            left = right;
+                            idx  = apex_at = left_at = right_at;
+
+                            continue;
+                        }
+                    }
+                }
+
+                if( corners.back() != gates.back().first ) corners.push_back( gates.back().first );
+
+                return corners;
+            }
+
+        private:
+            static bool _inside( const Cell& cell, const Vec2& vec ) {
+                if( vec.x < cell.b0.x || vec.x > cell.b1.x ) return false;
+
+                return _cross( cell.b1 - cell.b0, vec - cell.b0 ) >= 0.0 && _cross( cell.t1 - cell.t0, vec - cell.t0 ) <= 0.0;
+            }
+
+            static T _y_at( const Edge& edge, T x ) {
+                if( x == edge.a.x ) return edge.a.y;
+                if( x == edge.b.x ) return edge.b.y;
+
+                return edge.a.y + ( x - edge.a.x ) * ( edge.b.y - edge.a.y ) / ( edge.b.x - edge.a.x );
+            }
+
+            static uint64_t _key( size_t lo, size_t hi, size_t count ) {
+                return uint64_t( lo ) * count + hi;
+            }
+
+            static T _cross( const Vec2& a, const Vec2& b ) {
+                return a.x * b.y - a.y * b.x;
+            }
+
+        };
+
+
+
+        /*
+            Flow field towards a set of goals over a cell grid. Obstacles are rasterised into costs tile by
+            tile, then an eikonal pass integrates the travel time out of the goals and every cell stores the
+            unit direction downhill. Tiles sweep in parallel in two checkerboard phases, so a tile is never
+            written while its edge neighbours read it, and keep waking their neighbours until nothing moves.
+        */
+        template< typename T >
+        class Flow2_t {
+        public:
+            typedef   Vec2_t< T >         Vec2;
+            typedef   Vec2_t< float >     Dir;
+            typedef   Box2_t< T >         Box2;
+            typedef   Clust2_t< T >       Clust2;
+            typedef   Nearest2_t< T >     Nearest2;
+
+        private:
+            enum Mark : uint8_t {
+                LEFT = 1, RIGHT = 2, DOWN = 4, UP = 8, AGAIN = 16
+            };
+
+            inline static constexpr size_t   TILE         = 16;
+            inline static constexpr size_t   TILE_SWEEPS  = 16;
+            inline static constexpr float    FAR          = std :: numeric_limits< float > :: infinity();
+
+        public:
+            Flow2_t() = default;
+
+            Flow2_t( const Box2& bounds, T cell )
+                : _min( bounds.min ), _cell( cell )
+            {
+                const Vec2 extent = bounds.extent();
+
+                _width   = std :: max< size_t >( 1, static_cast< size_t >( std :: ceil( static_cast< double >( extent.x / cell ) ) ) );
+                _height  = std :: max< size_t >( 1, static_cast< size_t >( std :: ceil( static_cast< double >( extent.y / cell ) ) ) );
+                _tiles_w = ( _width + TILE - 1 ) / TILE;
+                _tiles_h = ( _height + TILE - 1 ) / TILE;
+
+                _cost.assign( _width * _height, 1.0f );
+                _value.assign( _width * _height, FAR );
+                _dirs.assign( _width * _height, Dir{} );
+                _dirty.assign( _tiles_w * _tiles_h, 1 );
+            }
+
+        private:
+            Vec2                           _min          = {};
+            T                              _cell         = 1.0;
+            T                              _radius       = 0.0;
+            size_t                         _width        = 0;
+            size_t                         _height       = 0;
+            size_t                         _tiles_w      = 0;
+            size_t                         _tiles_h      = 0;
+            std :: vector< float >         _cost         = {};
+            std :: vector< float >         _value        = {};
+            std :: vector< Dir >           _dirs         = {};
+            std :: vector< uint8_t >       _dirty        = {};
+            std :: vector< const Clust2* > _obstacles    = {};
+            std :: vector< Vec2 >          _goals        = {};
+            bool                           _full         = true;
+            Thread_pool                    _pool         = {};
+
+        public:
+            size_t width() const {
+                return _width;
+            }
+
+            size_t height() const {
+                return _height;
+            }
+
+            T cell() const {
+                return _cell;
+            }
+
+            Box2 bounds() const {
+                return { _min, _min + Vec2{ _cell * T( _width ), _cell * T( _height ) } };
+            }
+
+        public:
+            /*
+                Obstacles are kept by pointer and read again whenever their tiles are refreshed. A cell blocks
+                when its centre lies within radius plus half a cell of an obstacle.
+            */
+            Flow2_t& obstacles( std :: span< const Clust2* const > clusts, T radius = 0.0 ) {
+                _obstacles.assign( clusts.begin(), clusts.end() );
+                _radius = radius;
+
+                std :: fill( _dirty.begin(), _dirty.end(), 1 );
+
+                return *this;
+            }
+
+            Flow2_t& goals( std :: span< const Vec2 > vecs ) {
+                _goals.clear();
+
+                for( const Vec2& vec : vecs )
+                    if( _index( vec ) ) _goals.push_back( vec );
+
+                _full = true;
+
+                return *this;
+            }
+
+            /* Marks the tiles under region for rasterising again, typically the old and new box of a moved obstacle. */
+            Flow2_t& refresh( const Box2& region ) {
+                const auto [ c0, c1, r0, r1 ] = _tile_span( region, _radius + _cell );
+
+                for( size_t row = r0; row < r1; ++row )
+                    for( size_t col = c0; col < c1; ++col )
+                        _dirty[ row * _tiles_w + col ] = 1;
+
+                return *this;
+            }
+
+            /*
+                Brings the field up to date. After a goal change everything is integrated again. Otherwise only
+                the dirty tiles are rasterised, and if any cost went up every value at or above the lowest old
+                value among them is dropped, being the only ones whose way out could have crossed those tiles.
+                Every wave fans out over threads the field keeps between calls.
+            */
+            Flow2_t& integrate( size_t thread_count = 1 ) {
+                std :: vector< uint8_t > active( _tiles_w * _tiles_h, 0 );
+                std :: vector< uint8_t > touched( _tiles_w * _tiles_h, 0 );
+
+                const auto [ lowest, raised ] = _rasterize( active, thread_count );
+
+                if( _full ) {
+                    std :: fill( _value.begin(), _value.end(), FAR );
+                    std :: fill( active.begin(), active.end(), 1 );
+                }
+                else if( raised ) {
+                    for( size_t idx = 0; idx < _value.size(); ++idx ) {
+                        if( _value[ idx ] < lowest ) continue;
+
+                        _value[ idx ] = FAR;
+                        active[ _tile_of( idx ) ] = 1;
+                    }
+                }
+
+                _seed();
+
+                std :: vector< size_t > list{};
+
+                for( bool any = true; any; ) {
+                    any = false;
+
+                    for( size_t color = 0; color < 2; ++color ) {
+                        list.clear();
+
+                        for( size_t tile = 0; tile < active.size(); ++tile ) {
+                            if( !active[ tile ] || ( tile / _tiles_w + tile % _tiles_w ) % 2 != color ) continue;
+
+                            active[ tile ]  = 0;
+                            touched[ tile ] = 1;
+                            list.push_back( tile );
+                        }
+
+                        std :: vector< uint8_t > marks( list.size(), 0 );
+
+                        _pool.parallel_for( list.size(), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                            for( size_t idx = begin; idx < end; ++idx )
+                                marks[ idx ] = _sweep_tile( list[ idx ] );
+                        } );
+
+                        for( size_t idx = 0; idx < list.size(); ++idx )
+                            any |= _wake( list[ idx ], marks[ idx ], active );
+                    }
+                }
+
+                list.clear();
+
+                for( size_t tile = 0; tile < touched.size(); ++tile ) {
+                    const size_t tx = tile % _tiles_w;
+                    const size_t ty = tile / _tiles_w;
+
+                    if(
+                        touched[ tile ]
+                        || ( tx > 0 && touched[ tile - 1 ] ) || ( tx + 1 < _tiles_w && touched[ tile + 1 ] )
+                        || ( ty > 0 && touched[ tile - _tiles_w ] ) || ( ty + 1 < _tiles_h && touched[ tile + _tiles_w ] )
+                    ) list.push_back( tile );
+                }
+
+                _pool.parallel_for( list.size(), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    for( size_t idx = begin; idx < end; ++idx )
+                        _point_tile( list[ idx ] );
+                } );
+
+                _full = false;
+
+                return *this;
+            }
+
+        public:
+            /* Unit direction downhill, zero on goals, blocked or unreachable cells and off the grid. */
+            Vec2 direction( const Vec2& vec ) const {
+                const auto idx = _index( vec );
+
+                return idx ? Vec2( _dirs[ *idx ] ) : Vec2{};
+            }
+
+            /* Travel time to the nearest goal, infinite when blocked, unreachable or off the grid. */
+            T value( const Vec2& vec ) const {
+                const auto idx = _index( vec );
+
+                return idx && _value[ *idx ] != FAR ? static_cast< T >( _value[ *idx ] ) : Scalar< T > :: inf();
+            }
+
+            bool blocked( const Vec2& vec ) const {
+                const auto idx = _index( vec );
+
+                return !idx || _cost[ *idx ] == FAR;
+            }
+
+            void directions( std :: span< const Vec2 > vecs, std :: span< Vec2 > out, size_t thread_count = 1 ) const {
+                parallel_for( std :: min( vecs.size(), out.size() ), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    for( size_t idx = begin; idx < end; ++idx )
+                        out[ idx ] = direction( vecs[ idx ] );
+                } );
+            }
+
+        private:
+            /* Returns the lowest old value under the dirty tiles and whether any of their costs went up. */
+            std :: pair< float, bool > _rasterize( std :: vector< uint8_t >& active, size_t thread_count ) {
+                std :: vector< size_t > list{};
+
+                for( size_t tile = 0; tile < _dirty.size(); ++tile ) {
+                    if( !_dirty[ tile ] ) continue;
+
+                    _dirty[ tile ] = 0;
+                    active[ tile ] = 1;
+                    list.push_back( tile );
+                }
+
+                for( const Clust2* clust : _obstacles )
+                    clust -> settle();
+
+                std :: vector< float >   lowest( list.size(), FAR );
+                std :: vector< uint8_t > raised( list.size(), 0 );
+
+                _pool.parallel_for( list.size(), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    std :: vector< Vec2 >     centres{};
+                    std :: vector< Nearest2 > nearest{};
+
+                    for( size_t idx = begin; idx < end; ++idx ) {
+                        const size_t tile = list[ idx ];
+                        const size_t c0   = ( tile % _tiles_w ) * TILE, c1 = std :: min( c0 + TILE, _width );
+                        const size_t r0   = ( tile / _tiles_w ) * TILE, r1 = std :: min( r0 + TILE, _height );
+
+                        std :: vector< float > before{};
+
+                        for( size_t row = r0; row < r1; ++row ) {
+                            for( size_t col = c0; col < c1; ++col ) {
+                                const size_t cell = row * _width + col;
+
+                                lowest[ idx ] = std :: min( lowest[ idx ], _value[ cell ] );
+                                before.push_back( _cost[ cell ] );
+                                _cost[ cell ] = 1.0f;
+                            }
+                        }
+
+                        _block_tile( c0, c1, r0, r1, centres, nearest );
+
+                        for( size_t row = r0, at = 0; row < r1; ++row )
+                            for( size_t col = c0; col < c1; ++col, ++at )
+                                if( _cost[ row * _width + col ] > before[ at ] ) raised[ idx ] = 1;
+                    }
+                } );
+
+                float low  = FAR;
+                bool  rise = false;
+
+                for( size_t idx = 0; idx < list.size(); ++idx ) {
+                    low  = std :: min( low, lowest[ idx ] );
+                    rise = rise || raised[ idx ];
+                }
+
+                return { low, rise };
+            }
+
+            void _block_tile( size_t c0, size_t c1, size_t r0, size_t r1, std :: vector< Vec2 >& centres, std :: vector< Nearest2 >& nearest ) {
+                const T    reach = _radius + _cell / T( 2 );
+                const Box2 tile  = {
+                    _min + Vec2{ _cell * T( c0 ), _cell * T( r0 ) },
+                    _min + Vec2{ _cell * T( c1 ), _cell * T( r1 ) }
+                };
+
+                for( const Clust2* clust : _obstacles ) {
+                    const Box2 box = clust -> box();
+
+                    if(
+                        box.min.x - reach > tile.max.x || box.max.x + reach < tile.min.x
+                        ||
+                        box.min.y - reach > tile.max.y || box.max.y + reach < tile.min.y
+                    ) continue;
+
+                    for( size_t row = r0; row < r1; ++row ) {
+                        centres.clear();
+
+                        for( size_t col = c0; col < c1; ++col )
+                            centres.push_back( _centre( col, row ) );
+
+                        nearest.resize( centres.size() );
+                        clust -> signed_distance( centres, nearest );
+
+                        for( size_t col = c0; col < c1; ++col )
+                            if( nearest[ col - c0 ].distance < reach ) _cost[ row * _width + col ] = FAR;
+                    }
+                }
+            }
+
+            /* Fast sweeping over the four orders until the tile settles, noting which edges moved. */
+            uint8_t _sweep_tile( size_t tile ) {
+                const size_t c0 = ( tile % _tiles_w ) * TILE, c1 = std :: min( c0 + TILE, _width );
+                const size_t r0 = ( tile / _tiles_w ) * TILE, r1 = std :: min( r0 + TILE, _height );
+
+                uint8_t marks = 0;
+
+                for( size_t sweep = 0; sweep < TILE_SWEEPS; ++sweep ) {
+                    bool changed = false;
+
+                    for( size_t order = 0; order < 4; ++order ) {
+                        for( size_t r = 0; r < r1 - r0; ++r ) {
+                            const size_t row = order & 2 ? r1 - 1 - r : r0 + r;
+
+                            for( size_t c = 0; c < c1 - c0; ++c ) {
+                                const size_t col  = order & 1 ? c1 - 1 - c : c0 + c;
+                                const size_t cell = row * _width + col;
+
+                                const float next = _solve( col, row );
+
+                                if( !( next < _value[ cell ] ) ) continue;
+
+                                _value[ cell ] = next;
+                                changed        = true;
+
+                                if( col == c0 )     marks |= LEFT;
+                                if( col == c1 - 1 ) marks |= RIGHT;
+                                if( row == r0 )     marks |= DOWN;
+                                if( row == r1 - 1 ) marks |= UP;
+                            }
+                        }
+                    }
+
+                    if( !changed ) return marks;
+                }
+
+                return marks | AGAIN;
+            }
+
+            bool _wake( size_t tile, uint8_t marks, std :: vector< uint8_t >& active ) const {
+                const size_t tx = tile % _tiles_w;
+                const size_t ty = tile / _tiles_w;
+
+                bool any = false;
+
+                auto wake = [ & ] ( bool when, size_t other ) -> void {
+                    if( !when ) return;
+
+                    active[ other ] = 1;
+                    any             = true;
+                };
+
+                wake( ( marks & LEFT ) && tx > 0, tile - 1 );
+                wake( ( marks & RIGHT ) && tx + 1 < _tiles_w, tile + 1 );
+                wake( ( marks & DOWN ) && ty > 0, tile - _tiles_w );
+                wake( ( marks & UP ) && ty + 1 < _tiles_h, tile + _tiles_w );
+                wake( marks & AGAIN, tile );
+
+                return any;
+            }
+
+            /* The cells around a goal take their exact distance, sparing the sweep its worst error near a point source. */
+            void _seed() {
+                for( const Vec2& goal : _goals ) {
+                    const size_t at  = *_index( goal );
+                    const size_t col = at % _width;
+                    const size_t row = at / _width;
+
+                    for( size_t r = row > 0 ? row - 1 : 0; r <= std :: min( row + 1, _height - 1 ); ++r ) {
+                        for( size_t c = col > 0 ? col - 1 : 0; c <= std :: min( col + 1, _width - 1 ); ++c ) {
+                            const size_t cell = r * _width + c;
+
+                            if( _cost[ cell ] == FAR ) continue;
+
+                            _value[ cell ] = std :: min( _value[ cell ], static_cast< float >( _centre( c, r ).dist_to( goal ) ) * _cost[ cell ] );
+                        }
+                    }
+                }
+            }
+
+            /* Godunov upwind update, costs scaled by the cell size. */
+            float _solve( size_t col, size_t row ) const {
+                const size_t cell = row * _width + col;
+                const float  f    = _cost[ cell ] * static_cast< float >( _cell );
+
+                if( f == FAR ) return FAR;
+
+                float a = std :: min( col > 0 ? _value[ cell - 1 ] : FAR, col + 1 < _width ? _value[ cell + 1 ] : FAR );
+                float b = std :: min( row > 0 ? _value[ cell - _width ] : FAR, row + 1 < _height ? _value[ cell + _width ] : FAR );
+
+                if( a > b ) std :: swap( a, b );
+
+                if( a == FAR ) return FAR;
+
+                if( b - a >= f ) return a + f;
+
+                return 0.5f * ( a + b + std :: sqrt( 2.0f * f * f - ( a - b ) * ( a - b ) ) );
+            }
+
+            void _point_tile( size_t tile ) {
+                const size_t c0 = ( tile % _tiles_w ) * TILE, c1 = std :: min( c0 + TILE, _width );
+                const size_t r0 = ( tile / _tiles_w ) * TILE, r1 = std :: min( r0 + TILE, _height );
+
+                for( size_t row = r0; row < r1; ++row ) {
+                    for( size_t col = c0; col < c1; ++col ) {
+                        const size_t cell = row * _width + col;
+                        const float  v    = _value[ cell ];
+
+                        _dirs[ cell ] = {};
+
+                        if( v == FAR ) continue;
+
+                        const float l = col > 0 ? _value[ cell - 1 ] : FAR;
+                        const float r = col + 1 < _width ? _value[ cell + 1 ] : FAR;
+                        const float d = row > 0 ? _value[ cell - _width ] : FAR;
+                        const float u = row + 1 < _height ? _value[ cell + _width ] : FAR;
+
+                        Dir dir = {
+                            std :: min( l, r ) < v ? ( l < r ? l - v : v - r ) : 0.0f,
+                            std :: min( d, u ) < v ? ( d < u ? d - v : v - u ) : 0.0f
+                        };
+
+                        const float mag = std :: sqrt( dir.x * dir.x + dir.y * dir.y );
+
+                        if( mag > 0.0f ) _dirs[ cell ] = { dir.x / mag, dir.y / mag };
+                    }
+                }
+            }
+
+        private:
+            Vec2 _centre( size_t col, size_t row ) const {
+                return _min + Vec2{ _cell * ( T( col ) + T( 0.5 ) ), _cell * ( T( row ) + T( 0.5 ) ) };
+            }
+
+            std :: optional< size_t > _index( const Vec2& vec ) const {
+                const T gx = ( vec.x - _min.x ) / _cell;
+                const T gy = ( vec.y - _min.y ) / _cell;
+
+                if( gx < 0.0 || gy < 0.0 || gx >= T( _width ) || gy >= T( _height ) ) return {};
+
+                return static_cast< size_t >( gy ) * _width + static_cast< size_t >( gx );
+            }
+
+            size_t _tile_of( size_t cell ) const {
+                return ( cell / _width / TILE ) * _tiles_w + ( cell % _width ) / TILE;
+            }
+
+            /* Half open tile ranges touched by box grown by pad, clamped to the grid. */
+            std :: array< size_t, 4 > _tile_span( const Box2& box, T pad ) const {
+                auto clamp = [ this ] ( T v, size_t n ) -> size_t {
+                    const T at = v / ( _cell * T( TILE ) );
+
+                    return at <= 0.0 ? 0 : std :: min( static_cast< size_t >( at ), n );
+                };
+
+                return {
+                    clamp( box.min.x - pad - _min.x, _tiles_w ),
+                    std :: min( clamp( box.max.x + pad - _min.x, _tiles_w ) + 1, _tiles_w ),
+                    clamp( box.min.y - pad - _min.y, _tiles_h ),
+                    std :: min( clamp( box.max.y + pad - _min.y, _tiles_h ) + 1, _tiles_h )
+                };
+            }
+
+        };
+
+
+
+        /*
+            Single contour of lines, quadratic and cubic Beziers and Catmull-Rom runs, all kept as cubics.
+            Flattening subdivides each cubic until it provably keeps within the tolerance of its chord, so
+            vertices gather where the curvature is. Results are cached per zoom, the tolerance rounded down
+            to a quarter power of two, and dropped on any edit.
+        */
+        template< typename T >
+        class Path2_t {
+        public:
+            typedef   Vec2_t< T >     Vec2;
+            typedef   Ray2_t< T >     Ray2;
+            typedef   Clust2_t< T >   Clust2;
+
+        public:
+            /* Cache levels per halving of the tolerance, requests round down to the level below. At most CACHED are kept. */
+            inline static constexpr int      LEVELS      = 4;
+            inline static constexpr size_t   CACHED      = 8;
+            inline static constexpr size_t   MAX_DEPTH   = 16;
+
+        private:
+            struct Piece {
+                Vec2     a       = {};
+                Vec2     b       = {};
+                Vec2     c       = {};
+                Vec2     d       = {};
+                size_t   depth   = 0;
+            };
+
+        public:
+            Path2_t() = default;
+
+            Path2_t( const Vec2& start )
+                : _ctrl{ start }
+            {}
+
+        private:
+            /* The start, then three per segment, the last of each on the curve. */
+            std :: vector< Vec2 >                              _ctrl     = {};
+            bool                                               _closed   = false;
+            mutable std :: map< int, std :: vector< Vec2 > >   _cache    = {};
+
+        public:
+            size_t segment_count() const {
+                return _ctrl.empty() ? 0 : ( _ctrl.size() - 1 ) / 3;
+            }
+
+            bool closed() const {
+                return _closed;
+            }
+
+            std :: span< const Vec2 > controls() const {
+                return _ctrl;
+            }
+
+        public:
+            Path2_t& move_to( const Vec2& vec ) {
+                _ctrl.assign( 1, vec );
+                _closed = false;
+                _cache.clear();
+
+                return *this;
+            }
+
+            Path2_t& line_to( const Vec2& to ) {
+                const Vec2 from = _tail();
+
+                return _push( from + ( to - from ) / T( 3 ), to + ( from - to ) / T( 3 ), to );
+            }
+
+            Path2_t& quad_to( const Vec2& ctrl, const Vec2& to ) {
+                const Vec2 from = _tail();
+
+                return _push( from + ( ctrl - from ) * T( 2 ) / T( 3 ), to + ( ctrl - to ) * T( 2 ) / T( 3 ), to );
+            }
+
+            Path2_t& cubic_to( const Vec2& c1, const Vec2& c2, const Vec2& to ) {
+                return _push( c1, c2, to );
+            }
+
+            /*
+                Spline from the current point through every point given. Alpha 0 is uniform, 0.5 centripetal
+                and 1 chordal. The run leans on the previous on-curve point, missing ends are mirrored.
+            */
+            Path2_t& catmull_rom_to( std :: span< const Vec2 > through, T alpha = 0.5 ) {
+                for( size_t idx = 0; idx < through.size(); ++idx ) {
+                    const Vec2 p1 = _tail();
+                    const Vec2 p2 = through[ idx ];
+
+                    if( p2 == p1 ) continue;
+
+                    const Vec2 p0 = _ctrl.size() > 1 ? _ctrl[ _ctrl.size() - 4 ] : p1 * T( 2 ) - p2;
+                    const Vec2 p3 = idx + 1 < through.size() ? through[ idx + 1 ] : p2 * T( 2 ) - p1;
+
+                    auto [ c1, c2 ] = _catmull_rom( p0, p1, p2, p3, alpha );
+
+                    _push( c1, c2, p2 );
+                }
+
+                return *this;
+            }
+
+            Path2_t& close() {
+                _closed = true;
+                _cache.clear();
+
+                return *this;
+            }
+
+            /* Closed spline through every point, each segment bending towards its neighbours on both sides. */
+            static Path2_t spline( std :: span< const Vec2 > through, T alpha = 0.5 ) {
+                const size_t n = through.size();
+
+                if( n == 0 ) return {};
+
+                Path2_t path{ through[ 0 ] };
+
+                for( size_t idx = 0; idx < n; ++idx ) {
+                    const Vec2& p0 = through[ ( idx + n - 1 ) % n ];
+                    const Vec2& p1 = through[ idx ];
+                    const Vec2& p2 = through[ ( idx + 1 ) % n ];
+                    const Vec2& p3 = through[ ( idx + 2 ) % n ];
+
+                    if( p1 == p2 ) continue;
+
+                    auto [ c1, c2 ] = _catmull_rom( p0, p1, p2, p3, alpha );
+
+                    path._push( c1, c2, p2 );
+                }
+
+                return path.close();
+            }
+
+        public:
+            /*
+                The curve keeps within pixel_tolerance / zoom of the line, empty unless both are positive. The
+                reference stays valid until the path is edited or its level is evicted. The cache is filled
+                from const calls, so one path is not to be flattened from several threads at once.
+            */
+            const std :: vector< Vec2 >& polyline( T zoom = 1.0, T pixel_tolerance = 0.25 ) const {
+                static const std :: vector< Vec2 > none{};
+
+                if( !( zoom > 0.0 ) || !( pixel_tolerance > 0.0 ) ) return none;
+
+                const double tolerance = static_cast< double >( pixel_tolerance ) / static_cast< double >( zoom );
+                const double bound     = 64.0 * LEVELS;
+                const int    level     = static_cast< int >( std :: clamp( std :: floor( std :: log2( tolerance ) * LEVELS ), -bound, bound ) );
+
+                auto [ itr, fresh ] = _cache.try_emplace( level );
+
+                if( !fresh ) return itr -> second;
+
+                _flatten( static_cast< T >( std :: exp2( double( level ) / LEVELS ) ), itr -> second );
+
+                /* Zoom drifts, so the level furthest from this one goes first. */
+                if( _cache.size() > CACHED ) {
+                    auto lowest  = _cache.begin();
+                    auto highest = std :: prev( _cache.end() );
+
+                    _cache.erase( level - lowest -> first > highest -> first - level ? lowest : highest );
+                }
+
+                return itr -> second;
+            }
+
+            /* The outline always closes, a last vertex repeating the first is dropped. */
+            Clust2 clust( T zoom = 1.0, T pixel_tolerance = 0.25 ) const {
+                const std :: vector< Vec2 >& line = polyline( zoom, pixel_tolerance );
+
+                size_t count = line.size();
+
+                if( count > 1 && line.front() == line.back() ) --count;
+
+                return Clust2{ line.begin(), line.begin() + count };
+            }
+
+            std :: vector< Ray2 > rays( T zoom = 1.0, T pixel_tolerance = 0.25 ) const {
+                const std :: vector< Vec2 >& line = polyline( zoom, pixel_tolerance );
+
+                std :: vector< Ray2 > out{};
+
+                out.reserve( line.size() );
+
+                for( size_t idx = 1; idx < line.size(); ++idx )
+                    if( line[ idx ] != line[ idx - 1 ] ) out.push_back( { line[ idx - 1 ], line[ idx ] - line[ idx - 1 ] } );
+
+                if( _closed && line.size() > 2 && line.back() != line.front() )
+                    out.push_back( { line.back(), line.front() - line.back() } );
+
+                return out;
+            }
+
+        private:
+            Vec2 _tail() {
+                if( _ctrl.empty() ) _ctrl.emplace_back( 0.0, 0.0 );
+
+                return _ctrl.back();
+            }
+
+            Path2_t& _push( const Vec2& c1, const Vec2& c2, const Vec2& to ) {
+                _tail();
+
+                _ctrl.push_back( c1 );
+                _ctrl.push_back( c2 );
+                _ctrl.push_back( to );
+                _cache.clear();
+
+                return *this;
+            }
+
+            void _flatten( T tolerance, std :: vector< Vec2 >& out ) const {
+                out.clear();
+
+                if( _ctrl.empty() ) return;
+
+                out.push_back( _ctrl.front() );
+
+                std :: vector< Piece > stack{};
+
+                for( size_t idx = 0; idx + 3 < _ctrl.size(); idx += 3 ) {
+                    stack.push_back( { _ctrl[ idx ], _ctrl[ idx + 1 ], _ctrl[ idx + 2 ], _ctrl[ idx + 3 ], 0 } );
+
+                    while( !stack.empty() ) {
+                        const Piece piece = stack.back();
+
+                        stack.pop_back();
+
+                        if( piece.depth == MAX_DEPTH || _flat( piece, tolerance ) ) {
+                            out.push_back( piece.d );
+                            continue;
+                        }
+
+                        const Vec2 ab   = ( piece.a + piece.b ) / T( 2 );
+                        const Vec2 bc   = ( piece.b + piece.c ) / T( 2 );
+                        const Vec2 cd   = ( piece.c + piece.d ) / T( 2 );
+                        const Vec2 abc  = ( ab + bc ) / T( 2 );
+                        const Vec2 bcd  = ( bc + cd ) / T( 2 );
+                        const Vec2 mid  = ( abc + bcd ) / T( 2 );
+
+                        stack.push_back( { mid, bcd, cd, piece.d, piece.depth + 1 } );
+                        stack.push_back( { piece.a, ab, abc, mid, piece.depth + 1 } );
+                    }
+                }
+            }
+
+            /*
+                Off the chord the curve weighs the inner controls by 3 u^2 t and 3 u t^2, which never sum past 3/4,
+                so the band around the chord widens by 4/3. Controls projecting past the ends still split.
+            */
+            static bool _flat( const Piece& piece, T tolerance ) {
+                const Vec2 chord  = piece.d - piece.a;
+                const T    len_sq = chord.mag_sq();
+
+                if( len_sq == 0.0 )
+                    return piece.a.dist_to( piece.b ) <= tolerance && piece.a.dist_to( piece.c ) <= tolerance;
+
+                const T band = tolerance * Scalar< T > :: sqrt( len_sq ) * T( 4 ) / T( 3 );
+
+                for( const Vec2& vec : { piece.b, piece.c } ) {
+                    const Vec2 rel    = vec - piece.a;
+                    const T    along  = rel.dot( chord );
+                    const T    across = chord.x * rel.y - chord.y * rel.x;
+
+                    if( along < 0.0 || along > len_sq || across > band || -across > band ) return false;
+                }
+
+                return true;
+            }
+
+            /* Inner controls of the Bezier matching the p1 to p2 span, knots spaced by distance to the alpha. */
+            static std :: pair< Vec2, Vec2 > _catmull_rom( const Vec2& p0, const Vec2& p1, const Vec2& p2, const Vec2& p3, T alpha ) {
+                auto knot = [ alpha ] ( const Vec2& l, const Vec2& r ) -> double {
+                    return std :: pow( static_cast< double >( l.dist_to( r ) ), static_cast< double >( alpha ) );
+                };
+
+                const double d1 = knot( p0, p1 );
+                const double d2 = knot( p1, p2 );
+                const double d3 = knot( p2, p3 );
+
+                const T k = static_cast< T >( d1 > 0.0 && d2 > 0.0 ? d1 / d2 : 1.0 );
+                const T m = static_cast< T >( d3 > 0.0 && d2 > 0.0 ? d3 / d2 : 1.0 );
+
+                return {
+                    p1 + ( ( p2 - p1 ) * k - ( p0 - p1 ) / k ) / ( T( 3 ) * ( k + T( 1 ) ) ),
+                    p2 + ( ( p1 - p2 ) * m - ( p3 - p2 ) / m ) / ( T( 3 ) * ( m + T( 1 ) ) )
+                };
+            }
+
+        };
+
+        
+
+    #pragma endregion D2
+
+
+
+    #pragma region Collision
+
+        template< typename T >
+        class Gjk_t {
+        public:
+            typedef   Vec2_t< T >          Vec2;
+            typedef   Clust2_t< T >        Clust2;
+            typedef   Contact2_t< T >      Contact2;
+            typedef   Proximity2_t< T >    Proximity2;
+
+        public:
+            inline static constexpr size_t   MAX_ITERATIONS   = 64;
+
+        private:
+            struct Vrtx {
+                Vec2     a     = {};
+                Vec2     b     = {};
+                Vec2     w     = {};
+                size_t   ia    = 0;
+                size_t   ib    = 0;
+                T        u     = 1.0;
+            };
+
+            struct Simplex {
+                Vrtx     v[ 3 ]   = {};
+                size_t   count    = 0;
+
+                Vec2 closest() const {
+                    switch( count ) {
+                        case 1: return v[ 0 ].w;
+                        case 2: return v[ 0 ].w * v[ 0 ].u + v[ 1 ].w * v[ 1 ].u;
+                        default: return Vec2 :: O();
+                    }
+                }
+
+                std :: pair< Vec2, Vec2 > witnesses() const {
+                    Vec2 a = {};
+                    Vec2 b = {};
+
+                    for( size_t idx = 0; idx < count; ++idx ) {
+                        a += v[ idx ].a * v[ idx ].u;
+                        b += v[ idx ].b * v[ idx ].u;
+                    }
+
+                    return { a, b };
+                }
+
+                Vec2 search() const {
+                    if( count == 1 ) return -v[ 0 ].w;
+
+                    Vec2   e    = v[ 1 ].w - v[ 0 ].w;
+                    T      side = _cross( e, -v[ 0 ].w );
+
+                    return side > 0.0 ? Vec2{ -e.y, e.x } : Vec2{ e.y, -e.x };
+                }
+
+                void solve() {
+                    if( count == 2 ) _solve2();
+                    else if( count == 3 ) _solve3();
+                }
+
+                void _solve2() {
+                    Vec2 w1 = v[ 0 ].w;
+                    Vec2 w2 = v[ 1 ].w;
+                    Vec2 e  = w2 - w1;
+
+                    T    d2 = -w1.dot( e );
+                    if( d2 <= 0.0 ) { v[ 0 ].u = 1.0; count = 1; return; }
+
+                    T    d1 = w2.dot( e );
+                    if( d1 <= 0.0 ) { v[ 0 ] = v[ 1 ]; v[ 0 ].u = 1.0; count = 1; return; }
+
+                    v[ 0 ].u = d1 / ( d1 + d2 );
+                    v[ 1 ].u = d2 / ( d1 + d2 );
+                    count = 2;
+                }
+
+                void _solve3() {
+                    Vec2 w1 = v[ 0 ].w;
+                    Vec2 w2 = v[ 1 ].w;
+                    Vec2 w3 = v[ 2 ].w;
+
+                    Vec2   e12   = w2 - w1;
+                    T      d12_1 = w2.dot( e12 );
+                    T      d12_2 = -w1.dot( e12 );
+
+                    Vec2   e13   = w3 - w1;
+                    T      d13_1 = w3.dot( e13 );
+                    T      d13_2 = -w1.dot( e13 );
+
+                    Vec2   e23   = w3 - w2;
+                    T      d23_1 = w3.dot( e23 );
+                    T      d23_2 = -w2.dot( e23 );
+
+                    T      n123   = _cross( e12, e13 );
+                    T      d123_1 = n123 * _cross( w2, w3 );
+                    T      d123_2 = n123 * _cross( w3, w1 );
+                    T      d123_3 = n123 * _cross( w1, w2 );
+
+                    if( d12_2 <= 0.0 && d13_2 <= 0.0 ) { 
+                        v[ 0 ].u = 1.0; count = 1; return; 
+                    }
+
+                    if( d12_1 > 0.0 && d12_2 > 0.0 && d123_3 <= 0.0 ) {
+                        v[ 0 ].u = d12_1 / ( d12_1 + d12_2 );
+                        v[ 1 ].u = d12_2 / ( d12_1 + d12_2 );
+                        count = 2; return;
+                    }
+
+                    if( d13_1 > 0.0 && d13_2 > 0.0 && d123_2 <= 0.0 ) {
+                        v[ 1 ]   = v[ 2 ];
+                        v[ 0 ].u = d13_1 / ( d13_1 + d13_2 );
+                        v[ 1 ].u = d13_2 / ( d13_1 + d13_2 );
+                        count = 2; return;
+                    }
+
+                    if( d12_1 <= 0.0 && d23_2 <= 0.0 ) { 
+                        v[ 0 ] = v[ 1 ]; v[ 0 ].u = 1.0; count = 1; return; 
+                    }
+
+                    if( d13_1 <= 0.0 && d23_1 <= 0.0 ) { 
+                        v[ 0 ] = v[ 2 ]; v[ 0 ].u = 1.0; count = 1; return; 
+                    }
+
+                    if( d23_1 > 0.0 && d23_2 > 0.0 && d123_1 <= 0.0 ) {
+                        v[ 0 ]   = v[ 2 ];
+                        v[ 0 ].u = d23_2 / ( d23_1 + d23_2 );
+                        v[ 1 ].u = d23_1 / ( d23_1 + d23_2 );
+                        count = 2; return;
+                    }
+
+                    T sum = d123_1 + d123_2 + d123_3;
+
+                    v[ 0 ].u = d123_1 / sum;
+                    v[ 1 ].u = d123_2 / sum;
+                    v[ 2 ].u = d123_3 / sum;
+                    count = 3;
+                }
+            };
+
+        public:
+            static Proximity2 proximity( const Clust2& c1, const Clust2& c2 ) {
+                Simplex simplex = _run( c1, c2 );
+
+                auto [ a, b ] = simplex.witnesses();
+
+                if( simplex.count == 3 ) return { 0.0, a, b, true };
 
-        public:
-            double dot( const Vec2& other ) const {
-                return x * other.x + y * other.y;
+                return { a.dist_to( b ), a, b, false };
             }
-            
+
+            static std :: optional< Contact2 > contact( const Clust2& c1, const Clust2& c2 ) {
+                if( c1.vrtx_count() == 0 || c2.vrtx_count() == 0 ) return {};
+
+                Simplex simplex = _run( c1, c2 );
+
+                if( simplex.count < 3 ) {
+                    auto [ a, b ] = simplex.witnesses();
+
+                    if( a.dist_sq_to( b ) > _epsilon( c1, c2 ) ) return {};
+                }
+
+                auto [ normal, depth ] = _expand( c1, c2, simplex );
+
+                return _manifold( c1, c2, normal, depth );
+            }
+
         public:
-            double mag_sq() const {
-                return x * x + y * y;
+            static void contacts( 
+                std :: span< const std :: pair< Clust2*, Clust2* > > pairs, 
+                std :: span< std :: optional< Contact2 > >           out 
+            ) {
+                for( size_t idx = 0; idx < pairs.size() && idx < out.size(); ++idx )
+                    out[ idx ] = contact( *pairs[ idx ].first, *pairs[ idx ].second );
+            }
+
+            static std :: vector< std :: optional< Contact2 > > contacts( 
+                std :: span< const std :: pair< Clust2*, Clust2* > > pairs
+            ) {
+                std :: vector< std :: optional< Contact2 > > out( pairs.size() );
+
+                contacts( pairs, out );
+
+                return out;
             }
 
-            double mag() const {
-                return std :: sqrt( mag_sq() );
+        private:
+            static T _cross( const Vec2& v1, const Vec2& v2 ) {
+                return v1.x * v2.y - v1.y * v2.x;
             }
 
-            double angel() const {
-                return Deg :: pull( std :: atan2( y, x ) );
+            static T _span_sq( const Clust2& c1, const Clust2& c2 ) {
+                return std :: max( c1.box().extent().mag_sq(), c2.box().extent().mag_sq() );
             }
 
-        public:
-            double dist_sq_to( const Vec2& other ) const {
-                return ( other.x - x ) * ( other.x - x ) + ( other.y - y ) * ( other.y - y );
+            static T _epsilon( const Clust2& c1, const Clust2& c2 ) {
+                return _span_sq( c1, c2 ) * Scalar< T > :: eps() * T( 1e-4 );
             }
 
-            double dist_to( const Vec2& other ) const {
-                return std :: sqrt( dist_sq_to( other ) );
+            static T _tolerance( const Clust2& c1, const Clust2& c2 ) {
+                return Scalar< T > :: sqrt( _span_sq( c1, c2 ) * Scalar< T > :: eps() ) * T( 1e-2 );
             }
 
-        public:
-            Vec2 respect_to( const Vec2& other ) const {
-                return { x - other.x, y - other.y };
+            static Vrtx _support( const Clust2& c1, const Clust2& c2, const Vec2& dir ) {
+                Vrtx vrtx{};
+
+                vrtx.ia = c1.template extreme< IDX >( dir );
+                vrtx.ib = c2.template extreme< IDX >( -dir );
+                vrtx.a  = c1( vrtx.ia );
+                vrtx.b  = c2( vrtx.ib );
+                vrtx.w  = vrtx.a - vrtx.b;
+
+                return vrtx;
             }
 
-            Vec2 operator () ( const Vec2& other ) const {
-                return this -> respect_to( other );
+            static Simplex _run( const Clust2& c1, const Clust2& c2 ) {
+                Simplex simplex{};
+
+                simplex.v[ 0 ] = _support( c1, c2, c2( 0 ) - c1( 0 ) );
+                simplex.count  = 1;
+
+                const T eps = _epsilon( c1, c2 );
+
+                for( size_t iter = 0; iter < MAX_ITERATIONS; ++iter ) {
+                    size_t save_ia[ 3 ];
+                    size_t save_ib[ 3 ];
+                    size_t save_count = simplex.count;
+
+                    for( size_t idx = 0; idx < save_count; ++idx ) {
+                        save_ia[ idx ] = simplex.v[ idx ].ia;
+                        save_ib[ idx ] = simplex.v[ idx ].ib;
+                    }
+
+                    simplex.solve();
+
+                    if( simplex.count == 3 ) break;
+
+                    Vec2 dir = simplex.search();
+
+                    if( dir.mag_sq() <= eps ) break;
+
+                    Vrtx vrtx = _support( c1, c2, dir );
+
+                    bool duplicate = false;
+
+                    for( size_t idx = 0; idx < save_count; ++idx )
+                        if( save_ia[ idx ] == vrtx.ia && save_ib[ idx ] == vrtx.ib ) 
+                            duplicate = true;
+
+                    if( duplicate ) break;
+
+                    simplex.v[ simplex.count++ ] = vrtx;
+                }
+
+                return simplex;
+            }
+
+            static std :: pair< Vec2, T > _expand( const Clust2& c1, const Clust2& c2, Simplex simplex ) {
+                Vrtx   poly[ MAX_ITERATIONS + 3 ];
+                size_t count = 0;
+
+                for( size_t idx = 0; idx < simplex.count; ++idx )
+                    poly[ count++ ] = simplex.v[ idx ];
+
+                if( count == 1 ) {
+                    Vrtx vrtx = _support( c1, c2, Vec2{ 1.0, 0.0 } );
+
+                    if( vrtx.w == poly[ 0 ].w ) vrtx = _support( c1, c2, Vec2{ -1.0, 0.0 } );
+
+                    if( vrtx.w == poly[ 0 ].w ) return { Vec2{ 1.0, 0.0 }, 0.0 };
+
+                    poly[ count++ ] = vrtx;
+                }
+
+                if( count == 2 ) {
+                    Vec2 e = poly[ 1 ].w - poly[ 0 ].w;
+
+                    Vrtx vrtx = _support( c1, c2, Vec2{ -e.y, e.x } );
+
+                    if( Scalar< T > :: abs( _cross( e, vrtx.w - poly[ 0 ].w ) ) <= _epsilon( c1, c2 ) )
+                        vrtx = _support( c1, c2, Vec2{ e.y, -e.x } );
+
+                    if( Scalar< T > :: abs( _cross( e, vrtx.w - poly[ 0 ].w ) ) <= _epsilon( c1, c2 ) ) {
+                        Vec2 normal = Vec2{ e.y, -e.x } / e.mag();
+
+                        return { normal.dot( c2() - c1() ) < 0.0 ? -normal : normal, 0.0 };
+                    }
+
+                    poly[ count++ ] = vrtx;
+                }
+
+                if( _cross( poly[ 1 ].w - poly[ 0 ].w, poly[ 2 ].w - poly[ 0 ].w ) < 0.0 )
+                    std :: swap( poly[ 1 ], poly[ 2 ] );
+
+
+                const T tolerance = _tolerance( c1, c2 );
+
+                Vec2   normal = {};
+                T      depth  = 0.0;
+
+                for( size_t iter = 0; iter < MAX_ITERATIONS; ++iter ) {
+                    size_t edge = 0;
+
+                    depth = Scalar< T > :: inf();
+
+                    for( size_t idx = 0; idx < count; ++idx ) {
+                        Vec2   e   = poly[ ( idx + 1 ) % count ].w - poly[ idx ].w;
+                        T      len = e.mag();
+
+                        if( len == 0.0 ) continue;
+
+                        Vec2   n    = Vec2{ e.y, -e.x } / len;
+                        T      dist = n.dot( poly[ idx ].w );
+
+                        if( dist < depth ) {
+                            depth  = dist;
+                            normal = n;
+                            edge   = idx;
+                        }
+                    }
+
+                    Vrtx vrtx = _support( c1, c2, normal );
+
+                    if( vrtx.w.dot( normal ) - depth <= tolerance || count == MAX_ITERATIONS + 3 ) break;
+
+                    std :: move_backward( poly + edge + 1, poly + count, poly + count + 1 );
+
+                    poly[ edge + 1 ] = vrtx;
+
+                    ++count;
+                }
+
+                return { normal, std :: max( depth, T( 0 ) ) };
+            }
+
+            static Contact2 _manifold( const Clust2& c1, const Clust2& c2, const Vec2& normal, T depth ) {
+                struct Edge {
+                    Vec2 v1, v2, max;
+                };
+
+                auto best_edge = [] ( const Clust2& clust, const Vec2& n ) -> Edge {
+                    const size_t count = clust.vrtx_count();
+                    const size_t idx   = clust.template extreme< IDX >( n );
+
+                    Vec2 v    = clust( idx );
+                    Vec2 prev = clust( ( idx + count - 1 ) % count );
+                    Vec2 next = clust( ( idx + 1 ) % count );
+
+                    Vec2 l = v - next;
+                    Vec2 r = v - prev;
+
+                    T l_len = l.mag();
+                    T r_len = r.mag();
+
+                    T l_dot = l_len == 0.0 ? T( 1 ) : Scalar< T > :: abs( l.dot( n ) ) / l_len;
+                    T r_dot = r_len == 0.0 ? T( 1 ) : Scalar< T > :: abs( r.dot( n ) ) / r_len;
+
+                    return r_dot <= l_dot ? Edge{ prev, v, v } : Edge{ v, next, v };
+                };
+
+                Contact2 contact{};
+
+                contact.normal = normal;
+                contact.depth  = depth;
+
+                Edge e1 = best_edge( c1, normal );
+                Edge e2 = best_edge( c2, -normal );
+
+                auto alignment = [ &normal ] ( const Edge& e ) -> T {
+                    Vec2 d = e.v2 - e.v1;
+                    T len = d.mag();
+                    return len == 0.0 ? T( 1 ) : Scalar< T > :: abs( d.dot( normal ) ) / len;
+                };
+
+                bool flip = alignment( e1 ) > alignment( e2 );
+
+                const Edge& ref = flip ? e2 : e1;
+                const Edge& inc = flip ? e1 : e2;
+
+                Vec2   ref_dir = ref.v2 - ref.v1;
+                T ref_len = ref_dir.mag();
+
+                if( ref_len == 0.0 ) {
+                    contact.points[ 0 ] = c2( c2.template extreme< IDX >( -normal ) );
+                    contact.depths[ 0 ] = depth;
+                    contact.count       = 1;
+
+                    return contact;
+                }
+
+                ref_dir /= ref_len;
+
+                Vec2 clip[ 2 ] = { inc.v1, inc.v2 };
+
+                auto clip_by = [ &clip ] ( const Vec2& dir, T offs ) -> bool {
+                    T d1 = dir.dot( clip[ 0 ] ) - offs;
+                    T d2 = dir.dot( clip[ 1 ] ) - offs;
+
+                    if( d1 < 0.0 && d2 < 0.0 ) return false;
+
+                    if( d1 * d2 < 0.0 ) {
+                        Vec2 cut = clip[ 0 ] + ( clip[ 1 ] - clip[ 0 ] ) * ( d1 / ( d1 - d2 ) );
+
+                        ( d1 < 0.0 ? clip[ 0 ] : clip[ 1 ] ) = cut;
+                    }
+
+                    return true;
+                };
+
+                Vec2 face = Vec2{ -ref_dir.y, ref_dir.x };
+
+                if( face.dot( flip ? -normal : normal ) < 0.0 ) face = -face;
+
+                if( clip_by( ref_dir, ref_dir.dot( ref.v1 ) ) && clip_by( -ref_dir, -ref_dir.dot( ref.v2 ) ) ) {
+                    T plane = face.dot( ref.max );
+
+                    for( const Vec2& point : clip ) {
+                        T pen = plane - face.dot( point );
+
+                        if( pen < -depth * Scalar< T > :: sqrt( Scalar< T > :: eps() ) ) continue;
+
+                        contact.points[ contact.count ] = point;
+                        contact.depths[ contact.count ] = std :: max( pen, T( 0 ) );
+                        ++contact.count;
+                    }
+                }
+
+                if( contact.count == 0 ) {
+                    contact.points[ 0 ] = c2( c2.template extreme< IDX >( -normal ) );
+                    contact.depths[ 0 ] = depth;
+                    contact.count       = 1;
+                }
+
+                return contact;
             }
 
+        };
+
+
+
+        template< typename T >
+        class Collision_world_t {
+        public:
+            typedef   Ray2_t< T >      Ray2;
+            typedef   Box2_t< T >      Box2;
+            typedef   Clust2_t< T >    Clust2;
+
         public:
-            Vec2& polar( double angel, double dist ) {
-                Rad :: push( angel );
+            Collision_world_t() = default;
+
+            Collision_world_t( T margin )
+                : _margin( margin )
+            {}
+
+        public:
+            typedef   size_t   Proxy;
+
+            inline static constexpr Proxy   NIL   = ~Proxy{ 0 };
+
+        private:
+            struct Node {
+                Box2      box      = {};
+                Clust2*   clust    = nullptr;
+
+                Proxy     parent   = NIL;
+                Proxy     left     = NIL;
+                Proxy     right    = NIL;
+
+                int       height   = -1;
+
+                bool is_leaf() const {
+                    return left == NIL;
+                }
+            };
+
+        private:
+            std :: vector< Node >   _nodes    = {};
+            Proxy                   _root     = NIL;
+            Proxy                   _free     = NIL;
+            size_t                  _count    = 0;
+
+            T                       _margin   = 8.0;
+
+        public:
+            Proxy insert( Clust2& clust ) {
+                Proxy leaf = _alloc();
+
+                _nodes[ leaf ].clust  = &clust;
+                _nodes[ leaf ].box    = clust.box().fattened( _margin );
+                _nodes[ leaf ].height = 0;
+
+                _insert_leaf( leaf );
+
+                ++_count;
+
+                return leaf;
+            }
+
+            Collision_world_t& remove( Proxy proxy ) {
+                _remove_leaf( proxy );
+                _release( proxy );
 
-                x += std :: cos( angel ) * dist;
-                y += std :: sin( angel ) * dist;
+                --_count;
 
                 return *this;
             }
 
-            Vec2 polared( double angel, double dist ) const {
-                return Vec2( *this ).polar( angel, dist );
+            Collision_world_t& clear() {
+                _nodes.clear();
+
+                _root  = NIL;
+                _free  = NIL;
+                _count = 0;
+
+                return *this;
+            }
+
+        public:
+            Clust2& operator [] ( Proxy proxy ) {
+                return *_nodes[ proxy ].clust;
             }
 
+            const Box2& fat_box( Proxy proxy ) const {
+                return _nodes[ proxy ].box;
+            }
 
-            Vec2& approach( const Vec2 other, double dist ) {
-                return polar( other( *this ).angel(), dist );
+            size_t count() const {
+                return _count;
             }
-            
-            Vec2 approached( const Vec2 other, double dist ) const {
-                return Vec2{ *this }.approach( other, dist );
+
+            T margin() const {
+                return _margin;
             }
 
+            int height() const {
+                return _root == NIL ? 0 : _nodes[ _root ].height;
+            }
 
-            Vec2& spin( double theta ) {
-                Rad :: push( theta );
+        public:
+            bool refit( Proxy proxy ) {
+                Box2 box = _nodes[ proxy ].clust -> box();
 
-                double nx = x * std :: cos( theta ) - y * std :: sin( theta );
-                y = x * std :: sin( theta ) + y * std :: cos( theta );
-                x = nx;
+                if( _nodes[ proxy ].box.contains( box ) ) return false;
 
-                return *this;
+                _remove_leaf( proxy );
+
+                _nodes[ proxy ].box = box.fattened( _margin );
+
+                _insert_leaf( proxy );
+
+                return true;
             }
 
-            Vec2& spin( double theta, const Vec2& other ) {
-                *this = this -> respect_to( other ).spin( theta ) + other;
+            Collision_world_t& refit() {
+                for( Proxy proxy = 0; proxy < _nodes.size(); ++proxy )
+                    if( _nodes[ proxy ].height == 0 )
+                        refit( proxy );
 
                 return *this;
             }
 
-            Vec2 spinned( double theta ) const {
-                return Vec2{ *this }.spin( theta );
+        public:
+            template< typename F >
+            requires std :: is_invocable_v< F, Clust2& >
+            void query( const Box2& box, F&& func ) const {
+                _traverse(
+                    [ &box ] ( const Node& node ) -> bool { return node.box.overlaps( box ); },
+                    [ &func ] ( Proxy, const Node& node ) -> void { std :: invoke( func, *node.clust ); }
+                );
+            }
+
+            template< typename F >
+            requires std :: is_invocable_v< F, Clust2& >
+            void query( const Ray2& ray, F&& func ) const {
+                _traverse(
+                    [ &ray ] ( const Node& node ) -> bool { return node.box.strike( ray ).has_value(); },
+                    [ &func ] ( Proxy, const Node& node ) -> void { std :: invoke( func, *node.clust ); }
+                );
+            }
+
+            std :: vector< Clust2* > query( const Box2& box ) const {
+                std :: vector< Clust2* > hits{};
+
+                query( box, [ &hits ] ( Clust2& clust ) -> void { hits.push_back( &clust ); } );
+
+                return hits;
+            }
+
+            std :: vector< Clust2* > query( const Ray2& ray ) const {
+                std :: vector< Clust2* > hits{};
+
+                query( ray, [ &hits ] ( Clust2& clust ) -> void { hits.push_back( &clust ); } );
+
+                return hits;
             }
 
         public:
-            bool is_further_than( const Vec2& other, Heading heading ) const {
-                switch( heading ) {
-                    case Heading :: NORTH: return y > other.y;
-                    case Heading :: EAST:  return x > other.x;
-                    case Heading :: SOUTH: return y < other.y;
-                    case Heading :: WEST:  return x < other.x;
+            template< typename F >
+            requires std :: is_invocable_v< F, Proxy, Proxy >
+            void pairs( F&& func ) const {
+                for( Proxy proxy = 0; proxy < _nodes.size(); ++proxy ) {
+                    if( _nodes[ proxy ].height != 0 ) continue;
+
+                    const Box2& box = _nodes[ proxy ].box;
+
+                    _traverse(
+                        [ &box ] ( const Node& node ) -> bool { return node.box.overlaps( box ); },
+                        [ &func, proxy ] ( Proxy other, const Node& ) -> void { 
+                            if( other > proxy )
+                                std :: invoke( func, proxy, other ); 
+                        }
+                    );
                 }
+            }
 
-                return false;
+            template< typename F >
+            requires std :: is_invocable_v< F, Clust2&, Clust2& >
+            void pairs( F&& func ) const {
+                pairs( [ &func, this ] ( Proxy p1, Proxy p2 ) -> void {
+                    std :: invoke( func, *_nodes[ p1 ].clust, *_nodes[ p2 ].clust );
+                } );
             }
 
-        public:
-            template< typename T >
-            auto X( const Ray2& ray ) const;
+            std :: vector< std :: pair< Clust2*, Clust2* > > pairs() const {
+                std :: vector< std :: pair< Clust2*, Clust2* > > candidates{};
+
+                pairs( [ &candidates ] ( Clust2& c1, Clust2& c2 ) -> void { 
+                    candidates.emplace_back( &c1, &c2 ); 
+                } );
+
+                return candidates;
+            }
+
+            std :: vector< std :: pair< Clust2*, Clust2* > > collisions() const {
+                std :: vector< std :: pair< Clust2*, Clust2* > > hits{};
+
+                pairs( [ &hits ] ( Clust2& c1, Clust2& c2 ) -> void { 
+                    if( c1.collider().template X< bool >( c2.collider() ) )
+                        hits.emplace_back( &c1, &c2 ); 
+                } );
+
+                return hits;
+            }
+
+        private:
+            template< typename Pred, typename Leaf >
+            void _traverse( Pred&& pred, Leaf&& leaf ) const {
+                if( _root == NIL ) return;
+
+                /* Grows with the tree, a degenerate one can run deeper than any fixed bound. */
+                std :: vector< Proxy > stack{ _root };
+
+                while( !stack.empty() ) {
+                    Proxy idx = stack.back();
+
+                    stack.pop_back();
+
+                    const Node& node = _nodes[ idx ];
+
+                    if( !pred( node ) ) continue;
+
+                    if( node.is_leaf() ) {
+                        leaf( idx, node );
+
+                        continue;
+                    }
+
+                    stack.push_back( node.left );
+                    stack.push_back( node.right );
+                }
+            }
+
+        private:
+            Proxy _alloc() {
+                if( _free == NIL ) {
+                    _nodes.emplace_back();
+
+                    return _nodes.size() - 1;
+                }
+
+                Proxy idx = _free;
+
+                _free = _nodes[ idx ].parent;
+
+                _nodes[ idx ] = Node{};
+
+                return idx;
+            }
+
+            void _release( Proxy idx ) {
+                _nodes[ idx ] = Node{};
+
+                _nodes[ idx ].parent = _free;
+
+                _free = idx;
+            }
+
+            void _insert_leaf( Proxy leaf ) {
+                if( _root == NIL ) {
+                    _root = leaf;
+
+                    _nodes[ leaf ].parent = NIL;
+
+                    return;
+                }
+
+                Box2  box = _nodes[ leaf ].box;
+                Proxy idx = _root;
+
+                while( !_nodes[ idx ].is_leaf() ) {
+                    const Node& node = _nodes[ idx ];
+
+                    T area     = node.box.perimeter();
+                    T combined = node.box.merged( box ).perimeter();
+
+                    T cost    = 2.0 * combined;
+                    T inherit = 2.0 * ( combined - area );
+
+                    auto descend_cost = [ & ] ( Proxy child ) -> T {
+                        const Node& c = _nodes[ child ];
+
+                        T merged = c.box.merged( box ).perimeter();
+
+                        return ( c.is_leaf() ? merged : merged - c.box.perimeter() ) + inherit;
+                    };
+
+                    T cost_left  = descend_cost( node.left );
+                    T cost_right = descend_cost( node.right );
+
+                    if( cost < cost_left && cost < cost_right ) break;
+
+                    idx = cost_left < cost_right ? node.left : node.right;
+                }
+
+                Proxy sibling    = idx;
+                Proxy old_parent = _nodes[ sibling ].parent;
+                Proxy new_parent = _alloc();
+
+                _nodes[ new_parent ].parent = old_parent;
+                _nodes[ new_parent ].box    = _nodes[ sibling ].box.merged( box );
+                _nodes[ new_parent ].height = _nodes[ sibling ].height + 1;
+                _nodes[ new_parent ].left   = sibling;
+                _nodes[ new_parent ].right  = leaf;
 
-            template< typename T >
-            auto X( const Clust2& clust ) const;
+                _nodes[ sibling ].parent = new_parent;
+                _nodes[ leaf ].parent    = new_parent;
 
-        public:
-            bool operator == ( const Vec2& other ) const {
-                return x == other.x && y == other.y;
-            }
+                if( old_parent != NIL )
+                    ( _nodes[ old_parent ].left == sibling ? _nodes[ old_parent ].left : _nodes[ old_parent ].right ) = new_parent;
+                else
+                    _root = new_parent;
 
-            Vec2 operator + ( const Vec2& other ) const {
-                return { x + other.x, y + other.y };
+                _ascend( new_parent );
             }
 
-            Vec2 operator - ( const Vec2& other ) const {
-                return { x - other.x, y - other.y };
-            }
+            void _remove_leaf( Proxy leaf ) {
+                if( leaf == _root ) {
+                    _root = NIL;
 
-            Vec2 operator * ( const Vec2& other ) const {
-                return { x * other.x, y * other.y };
-            }
+                    return;
+                }
 
-            Vec2 operator / ( const Vec2& other ) const {
-                return { x / other.x, y / other.y };
-            }
+                Proxy parent  = _nodes[ leaf ].parent;
+                Proxy grand   = _nodes[ parent ].parent;
+                Proxy sibling = _nodes[ parent ].left == leaf ? _nodes[ parent ].right : _nodes[ parent ].left;
 
-            Vec2 operator + ( double delta ) const {
-                return { x + delta, y + delta };
-            }
+                _release( parent );
 
-            Vec2 operator - ( double delta ) const {
-                return { x - delta, y - delta };
-            }
+                _nodes[ sibling ].parent = grand;
 
-            Vec2 operator * ( double delta ) const {
-                return { x * delta, y * delta };
-            }
+                if( grand == NIL ) {
+                    _root = sibling;
 
-            Vec2 operator / ( double delta ) const {
-                return { x / delta, y / delta };
-            }
+                    return;
+                }
 
-            Vec2 operator >> ( double delta ) const {
-                return { x + delta, y };
-            }
+                ( _nodes[ grand ].left == parent ? _nodes[ grand ].left : _nodes[ grand ].right ) = sibling;
 
-            Vec2 operator ^ ( double delta ) const {
-                return { x, y + delta };
+                _ascend( grand );
             }
 
-            Vec2& operator += ( const Vec2& other ) {
-                x += other.x;
-                y += other.y;
+            void _ascend( Proxy idx ) {
+                for( ; idx != NIL; idx = _nodes[ idx ].parent ) {
+                    idx = _balance( idx );
 
-                return *this;
+                    Node& node = _nodes[ idx ];
+
+                    node.height = 1 + std :: max( _nodes[ node.left ].height, _nodes[ node.right ].height );
+                    node.box    = _nodes[ node.left ].box.merged( _nodes[ node.right ].box );
+                }
             }
 
-            Vec2& operator -= ( const Vec2& other ) {
-                x -= other.x;
-                y -= other.y;
+            Proxy _balance( Proxy ia ) {
+                Node& a = _nodes[ ia ];
 
-                return *this;
-            }
+                if( a.is_leaf() || a.height < 2 ) return ia;
 
-            Vec2& operator *= ( const Vec2& other ) {
-                x *= other.x;
-                y *= other.y;
+                Proxy ib = a.left;
+                Proxy ic = a.right;
 
-                return *this;
-            }
+                int balance = _nodes[ ic ].height - _nodes[ ib ].height;
 
-            Vec2& operator /= ( const Vec2& other ) {
-                x /= other.x;
-                y /= other.y;
+                if( balance > 1 ) return _rotate( ia, ic, ib, false );
+                if( balance < -1 ) return _rotate( ia, ib, ic, true );
 
-                return *this;
+                return ia;
             }
 
-            Vec2& operator *= ( double delta ) {
-                x *= delta;
-                y *= delta;
+            Proxy _rotate( Proxy ia, Proxy iup, Proxy istay, bool up_is_left ) {
+                Node& a  = _nodes[ ia ];
+                Node& up = _nodes[ iup ];
 
-                return *this;
-            }
+                Proxy i1 = up.left;
+                Proxy i2 = up.right;
 
-            Vec2& operator /= ( double delta ) {
-                x /= delta;
-                y /= delta;
+                up.left   = ia;
+                up.parent = a.parent;
+                a.parent  = iup;
 
-                return *this;
-            }
+                if( up.parent != NIL )
+                    ( _nodes[ up.parent ].left == ia ? _nodes[ up.parent ].left : _nodes[ up.parent ].right ) = iup;
+                else
+                    _root = iup;
 
-            Vec2& operator >>= ( double delta ) {
-                x += delta;
+                Proxy ikeep = i1;
+                Proxy igive = i2;
 
-                return *this;
-            }
+                if( _nodes[ i1 ].height <= _nodes[ i2 ].height ) std :: swap( ikeep, igive );
 
-            Vec2& operator ^= ( double delta ) {
-                y += delta;
+                up.right = ikeep;
 
-                return *this;
-            }
+                ( up_is_left ? a.left : a.right ) = igive;
 
-            Vec2 operator - () const {
-                return ( *this ) * -1.0;
-            }
+                _nodes[ igive ].parent = ia;
 
-        public:
-            static Vec2 O() {
-                return { 0.0, 0.0 };
-            }
+                a.box     = _nodes[ istay ].box.merged( _nodes[ igive ].box );
+                up.box    = a.box.merged( _nodes[ ikeep ].box );
+                a.height  = 1 + std :: max( _nodes[ istay ].height, _nodes[ igive ].height );
+                up.height = 1 + std :: max( a.height, _nodes[ ikeep ].height );
 
-        public:
-            void render( Ref< Renderer > renderer, Ref< Is_brush auto > brush ) const;
+                return iup;
+            }
 
         };
 
-    
-
-        class Ray2 {
-        public:
-            Ray2() = default;
 
-            Ray2( Vec2 org, Vec2 v )
-                : origin( org ), vec( v ) 
-            {}
 
+        template< typename T >
+        class Sweep_t {
         public:
-            Vec2   origin   = {};
-            Vec2   vec      = {};
+            typedef   Vec2_t< T >              Vec2;
+            typedef   Box2_t< T >              Box2;
+            typedef   Clust2_t< T >            Clust2;
+            typedef   Motion2_t< T >           Motion2;
+            typedef   Impact2_t< T >           Impact2;
+            typedef   Collision_world_t< T >   Collision_world;
 
         public:
-            Vec2 end() const {
-                return origin + vec;
-            }
+            inline static constexpr size_t   MAX_ITERATIONS   = 32;
 
         public:
-            double slope() const {
-                return ( end().y - origin.y ) / ( end().x - origin.x );
-            }
+            /* 
+                Conservative advancement: both shapes move by their motion over t in [ 0, 1 ], angular in degrees,
+                and the normal points from c1 to c2.
+            */
+            static std :: optional< Impact2 > impact( 
+                const Clust2& c1, const Motion2& m1, 
+                const Clust2& c2, const Motion2& m2, 
+                T tolerance = 0.0 
+            ) {
+                if( c1.vrtx_count() == 0 || c2.vrtx_count() == 0 ) return {};
 
-            std :: tuple< double, double, double > coeffs() const {
-                return { vec.y, -vec.x, vec.y * origin.x - vec.x * origin.y };
-            }
+                Clust2 a = c1.collider().snapshot();
+                Clust2 b = c2.collider().snapshot();
 
-        public:
-            template< typename T >
-            auto X( const Vec2& vec ) const {
-                this -> X< T >( Ray2{ Vec2 :: O(), vec } );
-            }
+                const Vec2 org_a = a.origin();
+                const Vec2 org_b = b.origin();
 
-            template< typename T >
-            auto X( const Ray2& other ) const {
-                if constexpr( std :: is_same_v< bool, T > ) 
-                    return _intersect_vec( other ).has_value();
-                else
-                    return _intersect_vec( other );
-            }
+                const T spin = Scalar< T > :: abs( Rad :: pull( m1.angular ) ) * a.reach() 
+                               + 
+                               Scalar< T > :: abs( Rad :: pull( m2.angular ) ) * b.reach();
 
-            bool Xprll( const Ray2& other ) const {
-                static auto is_normal = [] ( Vec2 normalized ) -> bool {
-                    return ( normalized.x >= 0.0 && normalized.x <= 1.0 )
-                           ||
-                           ( normalized.y >= 0.0 && normalized.y <= 1.0 );
-                };
+                if( tolerance <= T( 0 ) )
+                    tolerance = std :: min( a.box().extent().mag(), b.box().extent().mag() ) * T( 1e-3 );
 
+                T t = 0.0;
 
-                if( slope() != other.slope() ) return false; 
+                Vec2 normal = ( org_b - org_a );
 
+                for( size_t iter = 0; iter < MAX_ITERATIONS; ++iter ) {
+                    _place( a, org_a, m1, t );
+                    _place( b, org_b, m2, t );
 
-                return is_normal( other.origin( origin ) / vec )
-                       ||
-                       is_normal( other.end()( origin ) / vec )
-                       ||
-                       is_normal( origin( other.origin ) / other.vec )
-                       ||
-                       is_normal( end()( other.origin ) / other.vec );
-            }
+                    Proximity2_t< T > prox = Gjk_t< T > :: proximity( a, b );
 
-            template< typename T >
-            auto X( const Clust2& clust ) const;
+                    if( prox.overlap ) {
+                        if( iter > 0 ) return Impact2{ t, normal, prox.closest };
 
-        private:
-            std :: optional< Vec2 > _intersect_vec( const Ray2& other ) const {
-                /* Hai noroc nea' Peter +respect. */
+                        auto contact = Gjk_t< T > :: contact( a, b );
 
-                auto [ alpha, bravo, charlie ] = coeffs();
-                auto [ delta, echo, foxtrot ] = other.coeffs();
+                        if( !contact.has_value() ) return Impact2{ t, normal, prox.closest };
 
-                double golf = alpha * echo - bravo * delta;
+                        return Impact2{ t, contact -> normal, contact -> points[ 0 ] };
+                    }
 
-                if( golf == 0.0 ) return {};
+                    normal = ( prox.other_closest - prox.closest ) / prox.distance;
 
-                Vec2 int_vec = {
-                    ( charlie * echo - bravo * foxtrot ) / golf,
-                    ( alpha * foxtrot - delta * charlie ) / golf
-                };
+                    if( prox.distance <= tolerance ) 
+                        return Impact2{ t, normal, ( prox.closest + prox.other_closest ) / T( 2 ) };
 
-                Vec2 normalized = int_vec( origin ) / vec;
-                
-                if( !( ( normalized.x >= 0.0 && normalized.x <= 1.0 )
-                    ||
-                    ( normalized.y >= 0.0 && normalized.y <= 1.0 ) )
-                ) return {};
+                    const T closing = ( m1.linear - m2.linear ).dot( normal ) + spin;
 
-                normalized = int_vec( other.origin ) / other.vec;
+                    if( closing <= T( 0 ) ) return {};
 
-                if( !( ( normalized.x >= 0.0 && normalized.x <= 1.0 )
-                    ||
-                    ( normalized.y >= 0.0 && normalized.y <= 1.0 ) )
-                ) return {};
+                    t += ( prox.distance - tolerance / T( 2 ) ) / closing;
 
-                return int_vec;
+                    if( t > T( 1 ) ) return {};
+                }
+
+                return Impact2{ t, normal, a.origin() };
             }
 
         public:
-            void render( Ref< Renderer > renderer, Ref< Is_brush auto > brush ) const;
+            static void impacts( 
+                std :: span< const Clust2* const >            movers,
+                std :: span< const Motion2 >                  motions,
+                const Collision_world&                        world,
+                std :: span< std :: optional< Impact2 > >     out,
+                size_t                                        thread_count = 1
+            ) {
+                const size_t count = std :: min( { movers.size(), motions.size(), out.size() } );
 
-        };
+                std :: vector< size_t >          offs( count + 1, 0 );
+                std :: vector< const Clust2* >   candidates{};
 
+                for( size_t idx = 0; idx < count; ++idx ) {
+                    movers[ idx ] -> collider().box();
 
+                    world.query( swept_box( *movers[ idx ], motions[ idx ] ), [ & ] ( Clust2& clust ) -> void {
+                        if( &clust == movers[ idx ] ) return;
 
-        class Clust2 {
-        public:
-            Clust2() = default;
+                        clust.collider().box();
 
-            template< typename Iterator >
-            Clust2( Iterator begin, Iterator end ) {
-                _vrtx.reserve( std :: abs( std :: distance( begin, end ) ) );
+                        candidates.push_back( &clust );
+                    } );
 
-                for( ; begin != end; ++begin )
-                    _vrtx.emplace_back( *begin, *begin );
+                    offs[ idx + 1 ] = candidates.size();
+                }
+
+                parallel_for( count, thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    for( size_t idx = begin; idx < end; ++idx ) {
+                        out[ idx ].reset();
+
+                        for( size_t c = offs[ idx ]; c < offs[ idx + 1 ]; ++c ) {
+                            auto hit = impact( *movers[ idx ], motions[ idx ], *candidates[ c ], Motion2{} );
+
+                            if( hit.has_value() && ( !out[ idx ].has_value() || hit -> t < out[ idx ] -> t ) )
+                                out[ idx ] = hit;
+                        }
+                    }
+                } );
             }
 
-            template< typename Container >
-            Clust2( const Container& container )
-                : Clust2( container.begin(), container.end() )
-            {}
+            static Box2 swept_box( const Clust2& clust, const Motion2& motion ) {
+                Box2 box = clust.box();
 
-            template< typename T, typename Iterator >
-            requires ( 
-                std :: is_same_v< std :: decay_t< T >, Vec2 > 
-                || 
-                std :: is_same_v< std :: decay_t< T >, Clust2* > 
-            )
-            Clust2( T org, Iterator begin, Iterator end, Vec2 offs = {} ) 
-                : Clust2( begin, end ) 
-            {
-                if constexpr( std :: is_same_v< T, Vec2 > )
-                    _origin = org;
-                else
-                    _origin = { org, offs };
+                box = box.merged( { box.min + motion.linear, box.max + motion.linear } );
+
+                if( motion.angular != T( 0 ) ) {
+                    const Vec2 org   = clust.origin();
+                    const T    reach = clust.reach();
+
+                    box = box.merged( { org - reach, org + reach } ).merged( { org + motion.linear - reach, org + motion.linear + reach } );
+                }
+
+                return box;
             }
 
-            template< typename T, typename Container >
-            requires ( 
-                std :: is_same_v< std :: decay_t< T >, Vec2 > 
-                || 
-                std :: is_same_v< std :: decay_t< T >, Clust2* > 
-            )
-            Clust2( T org, const Container& container, Vec2 offs = {} ) 
-                : Clust2( org, container.begin(), container.end(), offs )
-            {}
-        
+        private:
+            static void _place( Clust2& clust, const Vec2& org, const Motion2& motion, T t ) {
+                clust.relocate( org + motion.linear * t );
+
+                if( motion.angular != T( 0 ) ) 
+                    clust.spin_at( motion.angular * t );
+            }
+
+        };
+
+
+
+        /*
+            Bodies own the pose of their Clust2 while in the world, spinning it about the center of mass.
+            Bodies must not be hooked, islands write their clusters from worker threads.
+        */
+        template< typename T >
+        class Physics_world_t {
         public:
-            Clust2( const Clust2& other )
-                : _origin( other._origin ),
-                  _vrtx  ( other._vrtx ),
-                  _scaleX( other._scaleX ),
-                  _scaleY( other._scaleY ),
-                  _angel ( other._angel )
-            {}
+            typedef   Vec2_t< T >              Vec2;
+            typedef   Clust2_t< T >            Clust2;
+            typedef   Contact2_t< T >          Contact2;
+            typedef   Mass2_t< T >             Mass2;
+            typedef   Collision_world_t< T >   Collision_world;
+            typedef   Gjk_t< T >               Gjk;
 
-            Clust2& operator = ( const Clust2& other ) { 
-                _origin = other._origin;
-                _vrtx   = other._vrtx;
-                _scaleX = other._scaleX;
-                _scaleY = other._scaleY;
-                _angel  = other._angel;
+        public:
+            typedef   size_t   Body_id;
 
-                return *this;
-            }
+            inline static constexpr Body_id   NIL   = ~Body_id{ 0 };
 
-            Clust2( Clust2&& other ) noexcept
-                : _origin( other._origin ),
-                  _vrtx  ( std :: move( other._vrtx ) ),
-                  _scaleX( other._scaleX ),
-                  _scaleY( other._scaleY ),
-                  _angel ( other._angel )
-            {}
+        public:
+            struct Config {
+                Vec2     gravity         = {};
+                T        step            = 1.0 / 120.0;
+                size_t   max_steps       = 8;
+                size_t   iterations      = 8;
+
+                T        margin          = 2.0;
+                T        baumgarte       = 0.2;
+                T        slop            = 0.5;
+
+                T        sleep_time      = 0.5;
+                T        sleep_linear    = 2.0;
+                T        sleep_angular   = 0.05;
+            };
 
-            Clust2& operator = ( Clust2&& other ) noexcept { 
-                _origin = std :: move( other._origin );
-                _vrtx   = std :: move( other._vrtx );
-                _scaleX = other._scaleX;
-                _scaleY = other._scaleY;
-                _angel  = other._angel;
+            struct Body {
+                Clust2*   clust         = nullptr;
 
-                return *this;
-            }
+                Vec2      velocity      = {};
+                T         spin          = 0.0;
 
-        private:
-            typedef   std :: variant< Vec2, std :: pair< Clust2*, Vec2 > >   Origin;
-            typedef   std :: pair< Vec2, Vec2 >                              Vrtx;
+                T         inv_mass      = 0.0;
+                T         inv_inertia   = 0.0;
+                T         friction      = 0.4;
+                T         restitution   = 0.0;
 
-            enum ORIGIN_VARIANT_ACCESS_INDEX {
-                VEC = 0,
-                HOOK = 1
+                Vec2      center        = {};
+                Vec2      arm           = {};
+                T         angel         = 0.0;
+                T         turn          = 0.0;
+
+                T         idle          = 0.0;
+                bool      asleep        = false;
+
+                typename Collision_world :: Proxy   proxy   = Collision_world :: NIL;
+
+                bool is_static() const {
+                    return inv_mass == 0.0;
+                }
             };
 
         private:
-            Origin                  _origin   = Vec2{ 0.0, 0.0 };
-            std :: vector< Vrtx >   _vrtx     = {};
+            struct Point {
+                Vec2   offs_a    = {};
+                Vec2   offs_b    = {};
+                T      depth     = 0.0;
+                T      bias      = 0.0;
+                T      k_normal  = 0.0;
+                T      k_tangent = 0.0;
+                T      p_normal  = 0.0;
+                T      p_tangent = 0.0;
+            };
+
+            struct Manifold {
+                Body_id   a           = NIL;
+                Body_id   b           = NIL;
+                Vec2      normal      = {};
+                T         friction    = 0.0;
+                Point     points[ 2 ] = {};
+                size_t    count       = 0;
+            };
 
-            double                  _scaleX   = 1.0;
-            double                  _scaleY   = 1.0;
-            double                  _angel    = 0.0;
+            struct Island {
+                std :: vector< Body_id >   bodies      = {};
+                std :: vector< size_t >    manifolds   = {};
+            };
 
         public:
-            Vec2 origin() const {
-                return is_hooked() ?
-                    const_cast< Clust2* >( this ) -> hook().origin() 
-                    + 
-                    const_cast< Clust2* >( this ) -> hook_offs()
-                    :
-                    std :: get< VEC >( _origin );
-            }
+            Physics_world_t()
+                : _broad( config.margin )
+            {}
 
-            Vec2& origin_ref() {
-                return is_hooked() ?
-                    hook().origin_ref()
-                    :
-                    std :: get< VEC >( _origin );
-            }
+            Physics_world_t( const Config& config )
+                : config( config ), _broad( config.margin )
+            {}
 
-            operator Vec2 () const {
-                return origin();
-            }
+        public:
+            Config   config   = {};
 
-            Vec2 operator () () const {
-                return this -> operator Vec2 ();
-            }
+        private:
+            std :: vector< Body >       _bodies      = {};
+            std :: vector< Body_id >    _free        = {};
+            std :: vector< Body_id >    _body_of     = {};
+
+            Collision_world             _broad       = {};
+
+            std :: vector< Manifold >   _manifolds   = {};
+            std :: map< std :: pair< Body_id, Body_id >, size_t >   _cache   = {};
+
+            T                           _lag         = 0.0;
+
+            Thread_pool                 _pool        = {};
 
         public:
-            bool is_hooked() const {
-                return _origin.index() == HOOK;
-            }
+            /* A zero density makes the body static. */
+            Body_id add( Clust2& clust, T density = 1.0 ) {
+                Body_id id = NIL;
+
+                if( _free.empty() ) {
+                    id = _bodies.size();
+                    _bodies.emplace_back();
+                } else {
+                    id = _free.back();
+                    _free.pop_back();
+                    _bodies[ id ] = {};
+                }
 
-            bool is_hookable_to( Clust2& other ) {
-                static bool ( *propagate )( Clust2&, Clust2* ) = [] ( Clust2& clust, Clust2* invoker ) -> bool {
-                    if( !clust.is_hooked() ) return true;
+                Body& body = _bodies[ id ];
 
-                    if( &clust.hook() == invoker ) return false;
+                body.clust  = &clust;
+                body.angel  = clust.angel();
+                body.center = clust.origin();
 
-                    return propagate( clust.hook(), invoker );
-                };
+                if( density > 0.0 ) {
+                    Mass2 mass = clust.mass( density );
 
-                return propagate( other, this );
-            }
+                    if( mass.mass > 0.0 ) {
+                        body.inv_mass    = T( 1 ) / mass.mass;
+                        body.inv_inertia = mass.inertia > 0.0 ? T( 1 ) / mass.inertia : T( 0 );
+                        body.center      = mass.center;
+                    }
+                }
 
-            Vec2& hook_offs() {
-                return std :: get< HOOK >( _origin ).second;
-            }
+                body.arm   = clust.origin() - body.center;
+                body.proxy = _broad.insert( clust );
 
-            Clust2& hook_offs_to( const Vec2& vec ) {
-                hook_offs() = vec;
+                if( _body_of.size() <= body.proxy ) _body_of.resize( body.proxy + 1, NIL );
 
-                return *this;
-            }
+                _body_of[ body.proxy ] = id;
 
-            Clust2& hook() {
-                return *std :: get< HOOK >( _origin ).first;
+                return id;
             }
 
-            Clust2& hook_to( Clust2& other, std :: optional< Vec2 > offs = {} ) {
-                _origin = std :: make_pair(
-                    &other,
-                    offs.value_or( origin()( other.origin() ) )
-                );
+            /* Bodies touching this one wake up, and its contacts go with it so a reused id starts cold. */
+            Physics_world_t& remove( Body_id id ) {
+                for( const Manifold& m : _manifolds )
+                    if( m.a == id || m.b == id ) wake( m.a == id ? m.b : m.a );
+
+                std :: erase_if( _manifolds, [ id ] ( const Manifold& m ) -> bool { return m.a == id || m.b == id; } );
+
+                _cache.clear();
+
+                for( size_t idx = 0; idx < _manifolds.size(); ++idx )
+                    _cache[ { _manifolds[ idx ].a, _manifolds[ idx ].b } ] = idx;
 
-                return *this;
-            }
+                Body& body = _bodies[ id ];
 
-            Clust2& dehook() {
-                _origin = origin();
+                _broad.remove( body.proxy );
+                _body_of[ body.proxy ] = NIL;
+
+                body.clust = nullptr;
+
+                _free.push_back( id );
 
                 return *this;
             }
 
         public:
-            Vec2& b_vrtx( size_t idx ) {
-                return _vrtx[ idx ].second;
+            Body& operator [] ( Body_id id ) {
+                return _bodies[ id ];
             }
 
-            Vec2& operator [] ( size_t idx ) {
-                return _vrtx[ idx ].first;
+            const Body& operator [] ( Body_id id ) const {
+                return _bodies[ id ];
             }
 
-            Vec2 operator() ( size_t idx ) const {
-                return _vrtx[ idx ].first + origin();
+            size_t count() const {
+                return _bodies.size() - _free.size();
             }
 
-            size_t vrtx_count() const {
-                return _vrtx.size();
-            }
+            size_t awake_count() const {
+                size_t count = 0;
 
-        public:
-            double angel() const {
-                return _angel;
-            }
+                for( const Body& body : _bodies )
+                    count += body.clust && !body.is_static() && !body.asleep;
 
-            double scaleX() const {
-                return _scaleX;
+                return count;
             }
 
-            double scaleY() const {
-                return _scaleY;
+            size_t contact_count() const {
+                return _manifolds.size();
             }
 
-            double scale() const {
-                return scaleX();
+            const Collision_world& broadphase() const {
+                return _broad;
             }
 
         public:
-            Clust2& operator = ( const Vec2& vec ) {
-                return relocate( vec );
-            }
-
-            Clust2& relocate( const Vec2& vec ) {
-                origin_ref() = vec;
+            Physics_world_t& wake( Body_id id ) {
+                _bodies[ id ].asleep = false;
+                _bodies[ id ].idle   = 0.0;
 
                 return *this;
             }
 
-            Clust2& relocate_by( size_t idx, const Vec2& vec ) {
-                origin_ref() += vec.respect_to( this -> operator()( idx ) );
+            Physics_world_t& apply_impulse( Body_id id, const Vec2& impulse, const Vec2& point ) {
+                Body& body = _bodies[ id ];
 
-                return *this;
+                if( body.is_static() ) return *this;
+
+                body.velocity += impulse * body.inv_mass;
+                body.spin     += body.inv_inertia * _cross( point - body.center, impulse );
+
+                return wake( id );
             }
 
         public:
-            Clust2& spin_with( double theta ) {
-                _angel += theta;
+            /* Runs as many fixed steps as the elapsed time allows, capped at config.max_steps. */
+            size_t advance( T elapsed, size_t thread_count = 1 ) {
+                _lag += elapsed;
 
-                _refresh();
+                size_t steps = 0;
 
-                return *this;
-            }
+                for( ; _lag >= config.step && steps < config.max_steps; ++steps ) {
+                    step( thread_count );
 
-            Clust2& spin_at( double theta ) {
-                _angel = theta;
+                    _lag -= config.step;
+                }
 
-                _refresh();
+                if( steps == config.max_steps ) _lag = 0.0;
 
-                return *this;
+                return steps;
             }
 
-            Clust2& scaleX_with( double delta ) {
-                _scaleX *= delta;
+            Physics_world_t& step( size_t thread_count = 1 ) {
+                _collide( thread_count );
 
-                _refresh();
+                std :: vector< Island > islands = _islands();
+
+                _pool.parallel_for( islands.size(), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    for( size_t idx = begin; idx < end; ++idx )
+                        _solve( islands[ idx ] );
+                } );
+
+                for( const Body& body : _bodies )
+                    if( body.clust && !body.is_static() && !body.asleep )
+                        _broad.refit( body.proxy );
 
                 return *this;
             }
 
-            Clust2& scaleY_with( double delta ) {
-                _scaleY *= delta;
+        private:
+            static T _cross( const Vec2& v1, const Vec2& v2 ) {
+                return v1.x * v2.y - v1.y * v2.x;
+            }
 
-                _refresh();
+            static Vec2 _cross( T w, const Vec2& v ) {
+                return { -w * v.y, w * v.x };
+            }
 
-                return *this;
+            bool _active( Body_id id ) const {
+                return !_bodies[ id ].is_static() && !_bodies[ id ].asleep;
             }
 
-            Clust2& scale_with( double delta ) {
-                _scaleX *= delta;
-                _scaleY *= delta;
+            void _collide( size_t thread_count ) {
+                std :: vector< std :: pair< Body_id, Body_id > > candidates{};
 
-                _refresh();
+                _broad.pairs( [ & ] ( typename Collision_world :: Proxy p1, typename Collision_world :: Proxy p2 ) -> void {
+                    Body_id a = _body_of[ p1 ];
+                    Body_id b = _body_of[ p2 ];
 
-                return *this;
-            }
+                    if( !_active( a ) && !_active( b ) ) return;
+                    if( _bodies[ a ].is_static() && _bodies[ b ].is_static() ) return;
+                    if( !_bodies[ a ].clust -> box().overlaps( _bodies[ b ].clust -> box() ) ) return;
 
-            Clust2& scaleX_at( double delta ) {
-                _scaleX = delta;
+                    candidates.emplace_back( std :: min( a, b ), std :: max( a, b ) );
+                } );
 
-                _refresh();
+                for( auto [ a, b ] : candidates ) {
+                    _bodies[ a ].clust -> settle();
+                    _bodies[ b ].clust -> settle();
+                }
 
-                return *this;
-            }
+                std :: vector< std :: optional< Contact2 > > contacts( candidates.size() );
 
-            Clust2& scaleY_at( double delta ) {
-                _scaleY = delta;
+                _pool.parallel_for( candidates.size(), thread_count, [ & ] ( size_t begin, size_t end ) -> void {
+                    for( size_t idx = begin; idx < end; ++idx )
+                        contacts[ idx ] = _bodies[ candidates[ idx ].first ].clust -> collider().template X< Contact2 >( 
+                            _bodies[ candidates[ idx ].second ].clust -> collider() 
+                        );
+                } );
 
-                _refresh();
+                std :: vector< Manifold >                                 manifolds{};
+                std :: map< std :: pair< Body_id, Body_id >, size_t >     cache{};
 
-                return *this;
-            }
+                for( size_t idx = 0; idx < candidates.size(); ++idx ) {
+                    if( !contacts[ idx ].has_value() ) continue;
 
-            Clust2& scale_at( double delta ) {
-                _scaleX = _scaleY = delta;
+                    const auto&    [ a, b ]  = candidates[ idx ];
+                    const Contact2& contact  = *contacts[ idx ];
 
-                _refresh();
+                    if( _bodies[ a ].asleep ) wake( a );
+                    if( _bodies[ b ].asleep ) wake( b );
 
-                return *this;
-            }
+                    Manifold& m = manifolds.emplace_back();
 
-        public:
-            static Clust2 triangle( double edge_length ) {
-                Vec2 vrtx = { 0.0, edge_length * std :: sqrt( 3.0 ) / 3.0 };
+                    m.a        = a;
+                    m.b        = b;
+                    m.normal   = contact.normal;
+                    m.count    = std :: min< size_t >( contact.count, 2 );
+                    m.friction = Scalar< T > :: sqrt( _bodies[ a ].friction * _bodies[ b ].friction );
 
-                return std :: vector< Vec2 >( {
-                    vrtx,
-                    vrtx.spinned( 120.0 ),
-                    vrtx.spinned( -120.0 )
-                } );
-            }
+                    const Manifold* old = nullptr;
 
-            static Clust2 square( double edge_length ) {
-                edge_length /= 2.0;
+                    if( auto itr = _cache.find( { a, b } ); itr != _cache.end() )
+                        old = &_manifolds[ itr -> second ];
 
-                return std :: vector< Vec2 >( {
-                    { edge_length, edge_length },
-                    { edge_length, -edge_length },
-                    { -edge_length, -edge_length },
-                    { -edge_length, edge_length }
-                } );
-            }
+                    for( size_t k = 0; k < m.count; ++k ) {
+                        Point& pt = m.points[ k ];
 
-            static Clust2 circle( double radius, size_t precision ) {
-                std :: vector< Vec2 > vrtx;
-                vrtx.reserve( precision );
+                        pt.offs_a = contact.points[ k ] - _bodies[ a ].center;
+                        pt.offs_b = contact.points[ k ] - _bodies[ b ].center;
+                        pt.depth  = contact.depths[ k ];
 
-                vrtx.emplace_back( 0.0, radius );
+                        if( !old ) continue;
 
-                for( size_t n = 1; n < precision; ++n )
-                    vrtx.push_back( vrtx.front().spinned( 360.0 / precision * n ) );
+                        /* Warm start from the previous step's point closest to this one. */
+                        for( size_t j = 0; j < old -> count; ++j )
+                            if( old -> points[ j ].offs_a.dist_sq_to( pt.offs_a ) <= T( 4 ) * config.slop * config.slop ) {
+                                pt.p_normal  = old -> points[ j ].p_normal;
+                                pt.p_tangent = old -> points[ j ].p_tangent;
 
-                return vrtx;
-            }
+                                break;
+                            }
+                    }
 
-            static Clust2 rect( Vec2 tl, Vec2 br ) {
-                return std :: vector< Vec2 >( {
-                    tl, Vec2( br.x, tl.y ), br, Vec2( tl.x, br.y )
-                } );
+                    cache[ { a, b } ] = manifolds.size() - 1;
+                }
+
+                _manifolds = std :: move( manifolds );
+                _cache     = std :: move( cache );
             }
 
-            template< typename T >
-            requires std :: is_invocable_v< T >
-            static Clust2 random( 
-                double min_dist, double max_dist, 
-                size_t min_ec, size_t max_ec, 
-                const T& generator 
-            ) {
-                static auto scalar = [] ( const auto& generator, double min ) -> double {
-                    return ( static_cast< double >( std :: invoke( generator ) % 10001 ) / 10000 )
-                           * ( 1.0 - min ) + min;
-                };
+            std :: vector< Island > _islands() {
+                std :: vector< Body_id > parent( _bodies.size() );
 
-                size_t edge_count = std :: invoke( generator ) % ( max_ec - min_ec + 1 ) + min_ec;
+                for( Body_id id = 0; id < parent.size(); ++id ) parent[ id ] = id;
 
-                Vec2 vrtx[ edge_count ];
+                auto find = [ &parent ] ( Body_id id ) -> Body_id {
+                    while( parent[ id ] != id ) id = parent[ id ] = parent[ parent[ id ] ];
 
-                vrtx[ 0 ] = { 0.0, max_dist };
+                    return id;
+                };
 
-                double diff = 360.0 / edge_count;
+                for( const Manifold& m : _manifolds )
+                    if( !_bodies[ m.a ].is_static() && !_bodies[ m.b ].is_static() ) {
+                        Body_id ra = find( m.a );
+                        Body_id rb = find( m.b );
 
+                        if( ra != rb ) parent[ std :: max( ra, rb ) ] = std :: min( ra, rb );
+                    }
 
-                for( size_t n = 1; n < edge_count; ++n )
-                    vrtx[ n ] = vrtx[ 0 ].spinned( diff * n + ( scalar( generator, min_dist / max_dist ) - 0.5 ) * diff )
-                                *
-                                scalar( generator, min_dist / max_dist );
+                std :: vector< Island >  islands{};
+                std :: vector< size_t >  island_of( _bodies.size(), NIL );
 
+                for( Body_id id = 0; id < _bodies.size(); ++id ) {
+                    if( !_bodies[ id ].clust || !_active( id ) ) continue;
 
-                return { vrtx, vrtx + edge_count };
-            }
+                    Body_id root = find( id );
 
-            //static Clust2 sprite( View< Sprite > sprite );
+                    if( island_of[ root ] == NIL ) {
+                        island_of[ root ] = islands.size();
+                        islands.emplace_back();
+                    }
 
-        public:
-            template< Word W >
-            requires ( W == REF || W == IDX )
-            typename std :: conditional_t< W == REF, Vec2&, size_t > extreme( Heading heading ) {
-                size_t ex_idx = 0;
+                    islands[ island_of[ root ] ].bodies.push_back( id );
+                }
 
-                for( size_t idx = 0; idx < vrtx_count(); ++idx )
-                    if( _vrtx[ idx ].first.is_further_than( _vrtx[ ex_idx ].first, heading ) )
-                        ex_idx = idx;
+                for( size_t idx = 0; idx < _manifolds.size(); ++idx ) {
+                    const Manifold& m = _manifolds[ idx ];
 
-                if constexpr( W == REF )
-                    return _vrtx[ ex_idx ].first;
-                else
-                    return ex_idx;
-            }
+                    Body_id dynamic = _bodies[ m.a ].is_static() ? m.b : m.a;
 
-            Vec2 extreme( Heading heading, System system = GLOBAL ) const {
-                return const_cast< Clust2* >( this ) -> extreme< REF >( heading ) 
-                       + 
-                       ( system == GLOBAL ? origin() : Vec2 :: O() );
-            }
+                    if( _active( dynamic ) )
+                        islands[ island_of[ find( dynamic ) ] ].manifolds.push_back( idx );
+                }
 
-        public:
-            template< typename T >
-            auto X( const Vec2& vec ) const {
-                return this -> X< T >( Ray2{ Vec2 :: O(), vec } );
+                return islands;
             }
 
-            template< typename T >
-            auto X( const Ray2& ray ) const {
-                if constexpr( std :: is_same_v< bool, T > )
-                    return _intersect_ray_bool( ray );
-                else
-                    return _intersect_ray_vec( ray );
-            }
+            void _solve( const Island& island ) {
+                const T dt = config.step;
 
-            template< typename T >
-            auto X( const Clust2& other ) const { 
-                if constexpr( std :: is_same_v< bool, T > )
-                    return _intersect_bool( other ); 
-                else
-                    return _intersect_vec( other );
-            }
+                for( Body_id id : island.bodies )
+                    _bodies[ id ].velocity += config.gravity * dt;
 
-        private:
-            bool _intersect_ray_bool( const Ray2& ray ) const {
-                for( size_t idx = 0; idx < vrtx_count(); ++idx )
-                    if( _mkray( idx ).X< bool >( ray ) )
-                        return true;
+                for( size_t idx : island.manifolds ) {
+                    Manifold& m = _manifolds[ idx ];
+                    Body&     a = _bodies[ m.a ];
+                    Body&     b = _bodies[ m.b ];
 
-                return false;
-            }
+                    const Vec2 tangent{ m.normal.y, -m.normal.x };
 
-            std :: vector< Vec2 > _intersect_ray_vec( const Ray2& ray ) const {
-                std :: vector< Vec2 > Xs{};
+                    for( size_t k = 0; k < m.count; ++k ) {
+                        Point& pt = m.points[ k ];
 
-                for( size_t idx = 0; idx < vrtx_count(); ++idx ) {
-                    auto vec = _mkray( idx ).X< Vec2 >( ray );
+                        T rn_a = _cross( pt.offs_a, m.normal );
+                        T rn_b = _cross( pt.offs_b, m.normal );
+                        T rt_a = _cross( pt.offs_a, tangent );
+                        T rt_b = _cross( pt.offs_b, tangent );
+
+                        T k_normal  = a.inv_mass + b.inv_mass + a.inv_inertia * rn_a * rn_a + b.inv_inertia * rn_b * rn_b;
+                        T k_tangent = a.inv_mass + b.inv_mass + a.inv_inertia * rt_a * rt_a + b.inv_inertia * rt_b * rt_b;
 
-                    if( vec.has_value() )
-                        Xs.push_back( vec.value() );
+                        pt.k_normal  = k_normal > 0.0 ? T( 1 ) / k_normal : T( 0 );
+                        pt.k_tangent = k_tangent > 0.0 ? T( 1 ) / k_tangent : T( 0 );
+
+                        T vn = _relative( a, b, pt ).dot( m.normal );
+
+                        pt.bias = config.baumgarte / dt * std :: max( pt.depth - config.slop, T( 0 ) )
+                                  - 
+                                  std :: min( vn, T( 0 ) ) * std :: max( a.restitution, b.restitution );
+
+                        _apply( a, b, pt, m.normal * pt.p_normal + tangent * pt.p_tangent );
+                    }
                 }
 
-                return Xs;
-            }
+                for( size_t iter = 0; iter < config.iterations; ++iter )
+                    for( size_t idx : island.manifolds ) {
+                        Manifold& m = _manifolds[ idx ];
+                        Body&     a = _bodies[ m.a ];
+                        Body&     b = _bodies[ m.b ];
 
-            bool _intersect_bool( const Clust2& other ) const {
-                for( size_t idx = 0; idx < other.vrtx_count(); ++idx )
-                    if( this -> X< bool >( other._mkray( idx ) ) )
-                        return true;
+                        const Vec2 tangent{ m.normal.y, -m.normal.x };
 
-                return false;
-            }
+                        for( size_t k = 0; k < m.count; ++k ) {
+                            Point& pt = m.points[ k ];
 
-            std :: vector< Vec2 > _intersect_vec( const Clust2& other ) const {
-                std :: vector< Vec2 > Xs{};
+                            T vt    = _relative( a, b, pt ).dot( tangent );
+                            T limit = m.friction * pt.p_normal;
+                            T p_t   = std :: clamp( pt.p_tangent - vt * pt.k_tangent, -limit, limit );
 
-                for( size_t idx = 0; idx < other.vrtx_count(); ++idx ) {
-                    auto vecs = this -> X< Vec2 >( other._mkray( idx ) );
+                            _apply( a, b, pt, tangent * ( p_t - pt.p_tangent ) );
+                            pt.p_tangent = p_t;
 
-                    Xs.insert( Xs.end(), vecs.begin(), vecs.end() );
-                }
+                            T vn  = _relative( a, b, pt ).dot( m.normal );
+                            T p_n = std :: max( pt.p_normal + ( pt.bias - vn ) * pt.k_normal, T( 0 ) );
 
-                return Xs;
-            }
-        
-        public:
-            bool contains( const Vec2& vec ) const {
-                Ray2 strike = { 
-                    vec, 
-                    ( vec >> ( vec.dist_sq_to( extreme( EAST, GLOBAL ) ) + 10.0 ) )( vec )
-                };
+                            _apply( a, b, pt, m.normal * ( p_n - pt.p_normal ) );
+                            pt.p_normal = p_n;
+                        }
+                    }
 
-                size_t intersections = 0;
-                
-                std :: pair< bool, bool > skip = { false, false };
+                T min_idle = Scalar< T > :: inf();
 
-                
-                for( size_t idx = 0; idx < vrtx_count(); ++idx ) {
-                    Ray2 edge = _mkray( idx, ( idx + 1 ) % vrtx_count() );
-                    
-                    if( skip.first ) {
-                        skip.first = false;
+                for( Body_id id : island.bodies ) {
+                    Body& body = _bodies[ id ];
 
-                        if( skip.second ? edge.end().y <= strike.origin.y : edge.end().y >= strike.origin.y )
-                            continue;
-                    }  
+                    body.center += body.velocity * dt;
+                    body.turn   += body.spin * dt;
 
-                    if( strike.X< bool >( edge ) ) {
-                        ++intersections;
+                    body.clust -> relocate( body.center + body.arm.spinned( Deg :: pull( body.turn ) ) );
+                    body.clust -> spin_at( body.angel + Deg :: pull( body.turn ) );
 
-                        if( skip.first = ( edge.end().y == strike.origin.y ) )
-                            skip.second = edge.origin.y > strike.origin.y; 
-                    }
-                }
+                    bool resting = body.velocity.mag_sq() <= config.sleep_linear * config.sleep_linear
+                                   &&
+                                   Scalar< T > :: abs( body.spin ) <= config.sleep_angular;
 
-                if( skip.first && !strike.Xprll( _mkray( 0, 1 ) ) )
-                    --intersections;
-                
-                return intersections % 2;
-            }
+                    body.idle = resting ? body.idle + dt : T( 0 );
+                    min_idle  = std :: min( min_idle, body.idle );
+                }
 
-        private:
-            void _refresh() {
-                for( Vrtx& v : _vrtx ) 
-                    v.first = v.second.spinned( _angel ) * Vec2( _scaleX, _scaleY );
-            }
+                if( min_idle < config.sleep_time ) return;
 
-            Ray2 _mkray( size_t idx ) const {
-                return { ( *this )( idx ), ( *this )( ( idx + 1 ) % vrtx_count() )( ( *this )( idx ) ) };
+                for( Body_id id : island.bodies ) {
+                    _bodies[ id ].asleep   = true;
+                    _bodies[ id ].velocity = {};
+                    _bodies[ id ].spin     = 0.0;
+                }
             }
 
-            Ray2 _mkray( size_t idx1, size_t idx2 ) const {
-                return { ( *this )( idx1 ), ( *this )( idx2 )( ( *this )( idx1 ) ) };
+            static Vec2 _relative( const Body& a, const Body& b, const Point& pt ) {
+                return b.velocity + _cross( b.spin, pt.offs_b ) - a.velocity - _cross( a.spin, pt.offs_a );
             }
-        
-        public:
-            static Clust2 from_file( std :: string_view path ) { 
-                std :: ifstream file( path.data() );
 
-                if( !file ) return {};
+            static void _apply( Body& a, Body& b, const Point& pt, const Vec2& impulse ) {
+                if( !a.is_static() ) {
+                    a.velocity -= impulse * a.inv_mass;
+                    a.spin     -= a.inv_inertia * _cross( pt.offs_a, impulse );
+                }
 
-                Vec2 org = {};
+                if( !b.is_static() ) {
+                    b.velocity += impulse * b.inv_mass;
+                    b.spin     += b.inv_inertia * _cross( pt.offs_b, impulse );
+                }
+            }
 
-                std :: vector< Vec2 > vrtx = {};
+        };
 
-                {
-                    bool has_origin = false;
+    #pragma endregion Collision
 
-                    file >> has_origin;
 
-                    if( has_origin )
-                        file >> org.x >> org.y;
-                }
 
-                for( Vec2 vec; file >> vec.x >> vec.y; )
-                    vrtx.push_back( vec );
+    template< typename T >
+    Proximity2_t< T > Clust2_t< T > :: proximity( const Clust2& other ) const {
+        return Gjk_t< T > :: proximity( *this, other );
+    }
 
-                return { org, vrtx };
-            }
-    
-        public:
-            void render( Ref< Renderer > renderer, Ref< Is_brush auto > brush ) const;
+    template< typename T >
+    std :: optional< Contact2_t< T > > Clust2_t< T > :: _intersect_contact( const Clust2& other ) const {
+        if( !_uses_parts() && !other._uses_parts() ) return Gjk_t< T > :: contact( *this, other );
 
-        };
+        if( !box().overlaps( other.box() ) ) return {};
 
+        const auto parts_a = _uses_parts() ? parts() : std :: span< const Clust2 >( this, 1 );
+        const auto parts_b = other._uses_parts() ? other.parts() : std :: span< const Clust2 >( &other, 1 );
 
+        std :: optional< Contact2 > deepest{};
 
-        template< typename T >
-        auto Vec2 :: X( const Ray2& ray ) const {
-            return ray.X< T >( *this );
-        }
+        for( const Clust2& a : parts_a ) {
+            if( !a.box().overlaps( other.box() ) ) continue;
 
-        template< typename T >
-        auto Vec2 :: X( const Clust2& clust ) const {
-            return clust.X< T >( *this );
-        }
+            for( const Clust2& b : parts_b ) {
+                if( !a.box().overlaps( b.box() ) ) continue;
 
+                auto contact = Gjk_t< T > :: contact( a, b );
 
-        template< typename T >
-        auto Ray2 :: X( const Clust2& clust ) const {
-            return clust.X< T >( *this );
+                if( contact.has_value() && ( !deepest.has_value() || contact -> depth > deepest -> depth ) )
+                    deepest = contact;
+            }
         }
 
-        
+        return deepest;
+    }
 
-    #pragma endregion D2
+    template< typename T >
+    std :: optional< Impact2_t< T > > Clust2_t< T > :: sweep( const Motion2& motion, const Clust2& other, const Motion2& other_motion ) const {
+        return Sweep_t< T > :: impact( *this, motion, other, other_motion );
+    }
 
 #pragma endregion Space
 
@@ -2503,9 +9934,9 @@ namespace _ENGINE_NAMESPACE {
             friend class Renderer;
 
         private:
-            friend class Vec2;
-            friend class Ray2;
-            friend class Clust2;
+            template< typename > friend class Vec2_t;
+            template< typename > friend class Ray2_t;
+            template< typename > friend class Clust2_t;
 
             friend class Solid_brush;
             friend class Linear_brush;
@@ -2754,6 +10185,11 @@ namespace _ENGINE_NAMESPACE {
                 Ref< Is_brush auto > brush
             );
 
+            Renderer& triangles(
+                std :: span< const Vec2 > vrtx, std :: span< const uint32_t > indices,
+                Ref< Is_brush auto > brush
+            );
+
         public:
             template< typename T, typename ...Args >
             Renderer& operator () ( const T& thing, Args&&... args ) {
@@ -3956,6 +11392,42 @@ namespace _ENGINE_NAMESPACE {
         );
     }
 
+    Renderer& Renderer :: triangles(
+        std :: span< const Vec2 > vrtx, std :: span< const uint32_t > indices,
+        Ref< Is_brush auto > brush
+    ) {
+        ID2D1Mesh*              mesh = nullptr;
+        ID2D1TessellationSink*  sink = nullptr;
+
+        if( indices.size() < 3 || _target -> CreateMesh( &mesh ) != S_OK ) return *this;
+
+        if( mesh -> Open( &sink ) == S_OK ) {
+            std :: vector< D2D1_TRIANGLE > tris( indices.size() / 3 );
+
+            for( size_t idx = 0; idx < tris.size(); ++idx )
+                tris[ idx ] = { 
+                    _surface -> pull_coord( vrtx[ indices[ 3 * idx ] ] ), 
+                    _surface -> pull_coord( vrtx[ indices[ 3 * idx + 1 ] ] ), 
+                    _surface -> pull_coord( vrtx[ indices[ 3 * idx + 2 ] ] ) 
+                };
+
+            sink -> AddTriangles( tris.data(), static_cast< UINT32 >( tris.size() ) );
+            sink -> Close();
+            sink -> Release();
+
+            /* FillMesh only draws aliased. */
+            auto mode = _target -> GetAntialiasMode();
+
+            _target -> SetAntialiasMode( D2D1_ANTIALIAS_MODE_ALIASED );
+            _target -> FillMesh( mesh, brush._brush );
+            _target -> SetAntialiasMode( mode );
+        }
+
+        mesh -> Release();
+
+        return *this;
+    }
+
     Renderer& Renderer :: fill( const Chroma& chroma = {} ) {
         _target -> Clear( chroma );
 
@@ -4054,28 +11526,48 @@ namespace _ENGINE_NAMESPACE {
 
 
 
-    void Vec2 :: render(
+    template< typename T >
+    void Vec2_t< T > :: render(
         Ref< Renderer > renderer ,
         Ref< Is_brush auto > brush
     ) const {
-        renderer.line( Vec2 :: O(), *this, brush );
+        renderer.line( Vec2_t< double > :: O(), Vec2_t< double >( *this ), brush );
     }
 
 
-    void Ray2 :: render(
+    template< typename T >
+    void Ray2_t< T > :: render(
         Ref< Renderer > renderer ,
         Ref< Is_brush auto > brush
     ) const {
-        renderer.line( origin, end(), brush );
+        renderer.line( Vec2_t< double >( origin ), Vec2_t< double >( end() ), brush );
     }
 
 
-    void Clust2 :: render(
+    template< typename T >
+    void Clust2_t< T > :: render(
         Ref< Renderer > renderer ,
         Ref< Is_brush auto > brush
     ) const {
         for( std :: size_t idx = 0; idx < vrtx_count(); ++idx )
-            renderer.line( ( *this )( idx ), ( *this )( ( idx + 1 ) % vrtx_count() ), brush );
+            renderer.line( Vec2_t< double >( ( *this )( idx ) ), Vec2_t< double >( ( *this )( ( idx + 1 ) % vrtx_count() ) ), brush );
+    }
+
+    template< typename T >
+    void Clust2_t< T > :: render(
+        Ref< Renderer > renderer ,
+        Ref< Is_brush auto > brush,
+        Paint paint
+    ) const {
+        if( paint == STROKE ) return render( renderer, brush );
+
+        std :: vector< Vec2_t< double > > vrtx{};
+        vrtx.reserve( vrtx_count() );
+
+        for( std :: size_t idx = 0; idx < vrtx_count(); ++idx )
+            vrtx.emplace_back( ( *this )( idx ) );
+
+        renderer.triangles( vrtx, triangles(), brush );
     }
 
 